@@ -4,6 +4,7 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 import esphome.core as core
 import esphome.core.config as cfg
+import esphome.final_validate as fv
 from esphome import automation
 from esphome.automation import maybe_simple_id
 from esphome.const import (
@@ -15,11 +16,19 @@ from esphome.const import (
     CONF_TYPE,
     CONF_TRIGGER_ID,
     CONF_PERIOD,
+    CONF_PRIORITY,
 )
 from esphome.core import CORE, coroutine_with_priority
 from .ha_deck import ha_deck_ns, HaDeck, HaDeckScreen
+from .hd_arc import ARC_CONFIG_SCHEMA, build_arc, validate_arc_range
 from .hd_button import BUTTON_CONFIG_SCHEMA, build_button
+from .hd_button_grid import BUTTON_GRID_CONFIG_SCHEMA, build_button_grid
+from .hd_chart import CHART_CONFIG_SCHEMA, build_chart, validate_chart_range
+from .hd_clock import CLOCK_CONFIG_SCHEMA, build_clock
+from .hd_image import IMAGE_CONFIG_SCHEMA, build_image, validate_image
+from .hd_list import LIST_CONFIG_SCHEMA, build_list
 from .hd_slider import SLIDER_CONFIG_SCHEMA, build_slider
+from .hd_thermostat import THERMOSTAT_CONFIG_SCHEMA, build_thermostat, validate_thermostat
 from .hd_value_card import VALUE_CARD_CONFIG_SCHEMA, build_value_card
 
 CODEOWNERS = ["@strange-v"]
@@ -34,14 +43,72 @@ CONF_MAIN_SCREEN = "main_screen"
 CONF_INACTIVITY = "inactivity"
 CONF_BLANK_SCREEN = "blank_screen"
 CONF_ON_INACTIVITY_CHANGE = "on_inactivity_change"
+CONF_BUILD_BUDGET = "build_budget"
+CONF_BENCHMARK = "benchmark"
+CONF_PREBUILD = "prebuild"
+CONF_PREBUILD_MEMORY = "prebuild_memory"
+CONF_SCREEN = "screen"
+CONF_STACK_DEPTH = "stack_depth"
+CONF_STACK_MEMORY = "stack_memory"
+CONF_SWIPE_SCREENS = "swipe_screens"
+CONF_TRANSITION = "transition"
+CONF_DURATION = "duration"
+CONF_MEMORY = "memory"
+CONF_OVERLAY = "overlay"
+CONF_IMAGE_CACHE = "image_cache"
+CONF_SWITCH_SCREEN_ACTION = "ha_deck.switch_screen"
+CONF_PUSH_SCREEN_ACTION = "ha_deck.push_screen"
+CONF_REPLACE_SCREEN_ACTION = "ha_deck.replace_screen"
+CONF_POP_SCREEN_ACTION = "ha_deck.pop_screen"
+NAVIGATION_ACTIONS = [
+    CONF_SWITCH_SCREEN_ACTION,
+    CONF_PUSH_SCREEN_ACTION,
+    CONF_REPLACE_SCREEN_ACTION,
+]
 
+CONF_ARC = "arc"
 CONF_BUTTON = "button"
+CONF_BUTTON_GRID = "button-grid"
+CONF_CHART = "chart"
+CONF_CLOCK = "clock"
+CONF_IMAGE = "image"
+CONF_LIST = "list"
 CONF_SLIDER = "slider"
+CONF_THERMOSTAT = "thermostat"
 CONF_VALUE_CARD = "value-card"
 
 InactivityChangeTrigger = ha_deck_ns.class_(
     "HaDeckInactivityChangeTrigger", automation.Trigger.template(cg.bool_)
 )
+HaDeckTransition = ha_deck_ns.enum("HaDeckTransition")
+TRANSITIONS = {
+    "none": HaDeckTransition.TRANSITION_NONE,
+    "slide": HaDeckTransition.TRANSITION_SLIDE,
+    "fade": HaDeckTransition.TRANSITION_FADE,
+    "cover": HaDeckTransition.TRANSITION_COVER,
+}
+
+SwitchScreenAction = ha_deck_ns.class_("HaDeckSwitchScreenAction", automation.Action)
+PushScreenAction = ha_deck_ns.class_("HaDeckPushScreenAction", automation.Action)
+ReplaceScreenAction = ha_deck_ns.class_("HaDeckReplaceScreenAction", automation.Action)
+PopScreenAction = ha_deck_ns.class_("HaDeckPopScreenAction", automation.Action)
+
+SWITCH_SCREEN_RE = re.compile(r'(?:switch|push|replace)_screen\(\s*"([^"]+)"\s*\)')
+
+def find_navigation_targets(value):
+    if isinstance(value, core.Lambda):
+        return SWITCH_SCREEN_RE.findall(value.value)
+    if isinstance(value, dict):
+        targets = []
+        for k, v in value.items():
+            if k in NAVIGATION_ACTIONS:
+                targets.append(v[CONF_SCREEN])
+            else:
+                targets += find_navigation_targets(v)
+        return targets
+    if isinstance(value, list):
+        return [t for v in value for t in find_navigation_targets(v)]
+    return []
 
 def validate_position(position):
     r = re.match(r"^([0-9]*),[ ]*([0-9]*)", position)
@@ -54,8 +121,15 @@ def validate_position(position):
         return [int(x), int(y)]
 
 WIDGET_BUILDERS = {
+    CONF_ARC: build_arc,
     CONF_BUTTON: build_button,
+    CONF_BUTTON_GRID: build_button_grid,
+    CONF_CHART: build_chart,
+    CONF_CLOCK: build_clock,
+    CONF_IMAGE: build_image,
+    CONF_LIST: build_list,
     CONF_SLIDER: build_slider,
+    CONF_THERMOSTAT: build_thermostat,
     CONF_VALUE_CARD: build_value_card,
 }
 
@@ -65,11 +139,19 @@ COMMON_WIDGET_SCHEMA = cv.Schema(
         cv.Optional(CONF_DIMENSIONS): cv.dimensions,
         cv.Optional(CONF_ENABLED): cv.returning_lambda,
         cv.Optional(CONF_VISIBLE): cv.returning_lambda,
+        cv.Optional(CONF_PRIORITY): cv.int_range(min=-100, max=100),
     }
 )
 WIDGET_SCHEMA = cv.typed_schema({
+    CONF_ARC: cv.All(COMMON_WIDGET_SCHEMA.extend(ARC_CONFIG_SCHEMA), validate_arc_range),
     CONF_BUTTON: COMMON_WIDGET_SCHEMA.extend(BUTTON_CONFIG_SCHEMA),
+    CONF_BUTTON_GRID: COMMON_WIDGET_SCHEMA.extend(BUTTON_GRID_CONFIG_SCHEMA),
+    CONF_CHART: cv.All(COMMON_WIDGET_SCHEMA.extend(CHART_CONFIG_SCHEMA), validate_chart_range),
+    CONF_CLOCK: COMMON_WIDGET_SCHEMA.extend(CLOCK_CONFIG_SCHEMA),
+    CONF_IMAGE: cv.All(COMMON_WIDGET_SCHEMA.extend(IMAGE_CONFIG_SCHEMA), validate_image),
+    CONF_LIST: COMMON_WIDGET_SCHEMA.extend(LIST_CONFIG_SCHEMA),
     CONF_SLIDER: COMMON_WIDGET_SCHEMA.extend(SLIDER_CONFIG_SCHEMA),
+    CONF_THERMOSTAT: cv.All(COMMON_WIDGET_SCHEMA.extend(THERMOSTAT_CONFIG_SCHEMA), validate_thermostat),
     CONF_VALUE_CARD: COMMON_WIDGET_SCHEMA.extend(VALUE_CARD_CONFIG_SCHEMA),
 })
 SCREEN_SCHEMA = cv.Schema(
@@ -80,6 +162,15 @@ SCREEN_SCHEMA = cv.Schema(
             cv.ensure_list(WIDGET_SCHEMA),
         ),
         cv.Optional(CONF_INACTIVITY): cv.int_,
+        cv.Optional(CONF_PREBUILD): cv.ensure_list(cv.string),
+    }
+)
+OVERLAY_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_ID): cv.declare_id(HaDeckScreen),
+        cv.Required(CONF_WIDGETS): cv.All(
+            cv.ensure_list(WIDGET_SCHEMA),
+        ),
     }
 )
 DECK_INACTIVITY_SCHEMA = cv.Schema(
@@ -88,6 +179,14 @@ DECK_INACTIVITY_SCHEMA = cv.Schema(
         cv.Optional(CONF_BLANK_SCREEN): cv.boolean,
     }
 )
+TRANSITION_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_TYPE, default="slide"): cv.enum(TRANSITIONS, lower=True),
+        cv.Optional(CONF_DURATION, default="250ms"): cv.positive_time_period_milliseconds,
+        # Two full-screen snapshots have to fit
+        cv.Optional(CONF_MEMORY, default=1048576): cv.int_range(min=0),
+    }
+)
 DECK_SCHEMA = cv.Schema(
     {
         cv.Required(CONF_ID): cv.declare_id(HaDeck),
@@ -96,6 +195,16 @@ DECK_SCHEMA = cv.Schema(
             cv.ensure_list(SCREEN_SCHEMA),
         ),
         cv.Optional(CONF_INACTIVITY): DECK_INACTIVITY_SCHEMA,
+        cv.Optional(CONF_BUILD_BUDGET, default="8ms"): cv.positive_time_period_microseconds,
+        cv.Optional(CONF_BENCHMARK, default=False): cv.boolean,
+        cv.Optional(CONF_PREBUILD_MEMORY, default=8192): cv.int_range(min=0),
+        cv.Optional(CONF_STACK_DEPTH, default=5): cv.int_range(min=1, max=16),
+        cv.Optional(CONF_STACK_MEMORY, default=8192): cv.int_range(min=0),
+        cv.Optional(CONF_SWIPE_SCREENS): cv.ensure_list(cv.string),
+        cv.Optional(CONF_TRANSITION): TRANSITION_SCHEMA,
+        cv.Optional(CONF_OVERLAY): OVERLAY_SCHEMA,
+        # Bytes of PSRAM for decoded images, shared by all screens
+        cv.Optional(CONF_IMAGE_CACHE, default=524288): cv.int_range(min=0),
         cv.Optional(CONF_ON_INACTIVITY_CHANGE): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(InactivityChangeTrigger),
@@ -103,10 +212,43 @@ DECK_SCHEMA = cv.Schema(
         ),
     }
 )
+def validate_screens(config):
+    names = [screen[CONF_NAME] for screen in config[CONF_SCREENS]]
+    for name in names:
+        if names.count(name) > 1:
+            raise cv.Invalid(f"Duplicate screen name '{name}'", [CONF_SCREENS])
+    if len(names) > 255:
+        raise cv.Invalid("At most 255 screens are supported", [CONF_SCREENS])
+    if config[CONF_MAIN_SCREEN] not in names:
+        raise cv.Invalid(f"Unknown screen '{config[CONF_MAIN_SCREEN]}'", [CONF_MAIN_SCREEN])
+    for i, name in enumerate(config.get(CONF_SWIPE_SCREENS, [])):
+        if name not in names:
+            raise cv.Invalid(f"Unknown screen '{name}'", [CONF_SWIPE_SCREENS, i])
+    for i, screen in enumerate(config[CONF_SCREENS]):
+        for target in screen.get(CONF_PREBUILD, []):
+            if target not in names:
+                raise cv.Invalid(f"Unknown screen '{target}'", [CONF_SCREENS, i, CONF_PREBUILD])
+    return config
+
 CONFIG_SCHEMA = cv.All(
     DECK_SCHEMA,
+    validate_screens,
 )
 
+def final_validate(config):
+    # Switch targets can be anywhere, in widgets as well as in other components' automations
+    names = [screen[CONF_NAME] for screen in config[CONF_SCREENS]]
+    for target in find_navigation_targets(fv.full_config.get()):
+        if target not in names:
+            raise cv.Invalid(f"switch_screen: unknown screen '{target}'")
+    return config
+
+FINAL_VALIDATE_SCHEMA = final_validate
+
+def get_screen_index(name):
+    names = [screen[CONF_NAME] for screen in CORE.config["ha_deck"][CONF_SCREENS]]
+    return names.index(name)
+
 async def widgets_to_code(screen, config):
     for item in config:
         obj = cg.new_Pvariable(item[CONF_ID])
@@ -120,6 +262,9 @@ async def widgets_to_code(screen, config):
             w, h = item[CONF_DIMENSIONS]
             cg.add(obj.set_dimensions(w, h))
 
+        if CONF_PRIORITY in item:
+            cg.add(obj.set_priority(item[CONF_PRIORITY]))
+
         if CONF_VISIBLE in item:
             visible = await cg.process_lambda(
                     item[CONF_VISIBLE], [], return_type=cg.optional.template(bool)
@@ -137,7 +282,7 @@ async def widgets_to_code(screen, config):
         if item[CONF_TYPE] in WIDGET_BUILDERS.keys():
             await WIDGET_BUILDERS[item[CONF_TYPE]](obj, item)
 
-async def screens_to_code(var, config):
+async def screens_to_code(var, config, swipe_screens):
     for item in config:
         screen = cg.new_Pvariable(item[CONF_ID])
         await cg.register_component(screen, item)
@@ -150,6 +295,16 @@ async def screens_to_code(var, config):
 
         cg.add(var.add_screen(screen))
 
+        # Switch targets found in the widgets' lambdas, plus the explicit ones
+        targets = item.get(CONF_PREBUILD, []) + find_navigation_targets(item.get(CONF_WIDGETS, []))
+        # Swipe neighbours are kept rendered so the slide shows real content
+        if name in swipe_screens:
+            i = swipe_screens.index(name)
+            targets += swipe_screens[max(i - 1, 0):i] + swipe_screens[i + 1:i + 2]
+        for target in dict.fromkeys(targets):
+            if target != name:
+                cg.add(screen.add_navigation_target(get_screen_index(target)))
+
         if CONF_WIDGETS in item:
             await widgets_to_code(screen, item[CONF_WIDGETS])
 
@@ -158,7 +313,18 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     main_screen = config.get(CONF_MAIN_SCREEN)
-    cg.add(var.set_main_screen(main_screen))
+    cg.add(var.set_main_screen(get_screen_index(main_screen)))
+    cg.add(var.set_build_budget(config[CONF_BUILD_BUDGET].total_microseconds))
+    cg.add(var.set_benchmark(config[CONF_BENCHMARK]))
+    cg.add(var.set_prebuild_memory(config[CONF_PREBUILD_MEMORY]))
+    cg.add(var.set_stack_depth(config[CONF_STACK_DEPTH]))
+    cg.add(var.set_stack_memory(config[CONF_STACK_MEMORY]))
+    cg.add(var.set_image_cache(config[CONF_IMAGE_CACHE]))
+
+    if transition := config.get(CONF_TRANSITION):
+        cg.add(var.set_transition(transition[CONF_TYPE]))
+        cg.add(var.set_transition_duration(transition[CONF_DURATION].total_milliseconds))
+        cg.add(var.set_transition_memory(transition[CONF_MEMORY]))
 
     if inactivity := config.get(CONF_INACTIVITY):
         if period := inactivity.get(CONF_PERIOD):
@@ -171,4 +337,40 @@ async def to_code(config):
         await automation.build_automation(trigger, [(bool, "x")], conf)
 
     if CONF_SCREENS in config:
-        await screens_to_code(var, config[CONF_SCREENS])
+        await screens_to_code(var, config[CONF_SCREENS], config.get(CONF_SWIPE_SCREENS, []))
+
+    for name in config.get(CONF_SWIPE_SCREENS, []):
+        cg.add(var.add_swipe_screen(get_screen_index(name)))
+
+    if overlay := config.get(CONF_OVERLAY):
+        screen = cg.new_Pvariable(overlay[CONF_ID])
+        await cg.register_component(screen, overlay)
+        cg.add(screen.set_name(CONF_OVERLAY))
+        await widgets_to_code(screen, overlay[CONF_WIDGETS])
+        cg.add(var.set_overlay(screen))
+
+SWITCH_SCREEN_ACTION_SCHEMA = cv.maybe_simple_value(
+    {
+        cv.GenerateID(): cv.use_id(HaDeck),
+        cv.Required(CONF_SCREEN): cv.string,
+    },
+    key=CONF_SCREEN,
+)
+
+@automation.register_action(CONF_SWITCH_SCREEN_ACTION, SwitchScreenAction, SWITCH_SCREEN_ACTION_SCHEMA)
+@automation.register_action(CONF_PUSH_SCREEN_ACTION, PushScreenAction, SWITCH_SCREEN_ACTION_SCHEMA)
+@automation.register_action(CONF_REPLACE_SCREEN_ACTION, ReplaceScreenAction, SWITCH_SCREEN_ACTION_SCHEMA)
+async def switch_screen_to_code(config, action_id, template_arg, args):
+    paren = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_arg, paren, get_screen_index(config[CONF_SCREEN]))
+
+POP_SCREEN_ACTION_SCHEMA = maybe_simple_id(
+    {
+        cv.GenerateID(): cv.use_id(HaDeck),
+    }
+)
+
+@automation.register_action(CONF_POP_SCREEN_ACTION, PopScreenAction, POP_SCREEN_ACTION_SCHEMA)
+async def pop_screen_to_code(config, action_id, template_arg, args):
+    paren = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_arg, paren)
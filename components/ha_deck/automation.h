@@ -1,13 +1,56 @@
 #pragma once
 
 #include "hd_button_automation.h"
+#include "hd_button_grid_automation.h"
+#include "hd_clock_automation.h"
+#include "hd_list_automation.h"
 #include "hd_slider_automation.h"
+#include "hd_thermostat_automation.h"
 #include "hd_value_card_automation.h"
 #include "ha_deck.h"
 
 namespace esphome {
 namespace ha_deck {
 
+template<typename... Ts> class HaDeckSwitchScreenAction : public Action<Ts...> {
+ public:
+  HaDeckSwitchScreenAction(HaDeck *deck, uint8_t screen) : deck_(deck), screen_(screen) {}
+  void play(Ts... x) override { this->deck_->switch_screen(this->screen_); }
+
+ protected:
+  HaDeck *deck_;
+  uint8_t screen_;
+};
+
+template<typename... Ts> class HaDeckPushScreenAction : public Action<Ts...> {
+ public:
+  HaDeckPushScreenAction(HaDeck *deck, uint8_t screen) : deck_(deck), screen_(screen) {}
+  void play(Ts... x) override { this->deck_->push_screen(this->screen_); }
+
+ protected:
+  HaDeck *deck_;
+  uint8_t screen_;
+};
+
+template<typename... Ts> class HaDeckReplaceScreenAction : public Action<Ts...> {
+ public:
+  HaDeckReplaceScreenAction(HaDeck *deck, uint8_t screen) : deck_(deck), screen_(screen) {}
+  void play(Ts... x) override { this->deck_->replace_screen(this->screen_); }
+
+ protected:
+  HaDeck *deck_;
+  uint8_t screen_;
+};
+
+template<typename... Ts> class HaDeckPopScreenAction : public Action<Ts...> {
+ public:
+  HaDeckPopScreenAction(HaDeck *deck) : deck_(deck) {}
+  void play(Ts... x) override { this->deck_->pop_screen(); }
+
+ protected:
+  HaDeck *deck_;
+};
+
 class HaDeckInactivityChangeTrigger : public Trigger<bool> {
  public:
   HaDeckInactivityChangeTrigger(HaDeck *deck) {
@@ -1,19 +1,48 @@
 #include "ha_deck.h"
 #include "esphome/core/hal.h"
+#include <algorithm>
+#include <esp_heap_caps.h>
 
 namespace esphome {
 namespace ha_deck {
 
+// Prebuilding waits until the UI has been untouched for a while
+static const uint32_t PREBUILD_IDLE_TIME = 500;
+// LVGL memory always left free for the active screen, by prebuilt and retained screens
+static const uint32_t PREBUILD_RESERVE = 4096;
+static const uint32_t SWIPE_ANIM_TIME = 250;
+// Set on the LVGL screen while the built main screen is shown on its own, without
+// a stack, swipe or transition. The SC01 Plus keeps only such frames as its splash.
+static const lv_obj_flag_t SETTLED_FLAG = LV_OBJ_FLAG_USER_1;
+
 void HaDeck::setup() { 
     lvgl_main_screen_ = lv_scr_act();
-    switch_screen(main_screen_name_);
+    // Screen containers scroll on their own
+    lv_obj_clear_flag(lvgl_main_screen_, LV_OBJ_FLAG_SCROLLABLE);
+    // Gestures bubble up from the screen containers, nothing runs until one is recognized
+    if (!swipe_screens_.empty())
+        lv_obj_add_event_cb(lvgl_main_screen_, HaDeck::on_gesture_, LV_EVENT_GESTURE, this);
+    if (benchmark_)
+        lv_obj_add_event_cb(lvgl_main_screen_, HaDeck::on_draw_post_end_, LV_EVENT_DRAW_POST_END, this);
+    switch_screen(main_screen_);
+
+    if (overlay_) {
+        overlay_->build_begin(lv_layer_top());
+        // Touches outside the overlay widgets reach the screen below
+        lv_obj_clear_flag(overlay_->get_container(), LV_OBJ_FLAG_CLICKABLE);
+    }
 
-    if (inactivity_timeout_) {
+    if (inactivity_blank_screen_) {
         create_inactivity_screen_();
     }
 }
 
 void HaDeck::loop() {
+    build_pending_screen_();
+    build_overlay_();
+    prebuild_screens_();
+    update_settled_();
+
     if (inactivity_timeout_ > 0) {
         if (lv_disp_get_inactive_time(NULL) > inactivity_timeout_) {
             set_inactivity_(true);
@@ -23,7 +52,9 @@ void HaDeck::loop() {
     }
 }
 
-float HaDeck::get_setup_priority() const { return setup_priority::AFTER_CONNECTION; }
+// Right after the display device, so the UI doesn't wait for Wi-Fi and the API.
+// Widgets show an unknown state until their sources publish.
+float HaDeck::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 
 void HaDeck::set_inactivity_period(uint32_t value) {
     inactivity_timeout_default_ = value * 1000;
@@ -37,32 +68,624 @@ bool HaDeck::get_inactivity() {
     return inactivity_;
 }
 
-void HaDeck::set_main_screen(std::string value) {
-    main_screen_name_ = value;
+void HaDeck::set_main_screen(uint8_t index) {
+    main_screen_ = index;
 }
 
 void HaDeck::add_screen(HaDeckScreen *screen) {
     ESP_LOGD(this->TAG, "add_screen: %s", screen->get_name().c_str());
-    screens_[screen->get_name()] = screen;
+    screen->set_index(screens_.size());
+    screens_.push_back(screen);
+}
+
+HaDeckScreen *HaDeck::get_screen(const std::string &name) {
+    for (auto screen : screens_) {
+        if (screen->get_name() == name)
+            return screen;
+    }
+    return nullptr;
+}
+
+void HaDeck::set_overlay(HaDeckScreen *overlay) {
+    overlay_ = overlay;
+}
+
+void HaDeck::set_build_budget(uint32_t value) {
+    build_budget_ = value;
+}
+
+void HaDeck::set_benchmark(bool value) {
+    benchmark_ = value;
+    HaDeckWidget::set_profile(value);
+}
+
+void HaDeck::set_image_cache(uint32_t value) {
+    HdImageCache::set_capacity(value);
+}
+
+void HaDeck::set_stack_depth(uint8_t value) {
+    stack_depth_ = value;
+}
+
+void HaDeck::set_stack_memory(uint32_t value) {
+    stack_memory_ = value;
+}
+
+void HaDeck::set_transition(HaDeckTransition value) {
+    transition_ = value;
+}
+
+void HaDeck::set_transition_duration(uint32_t value) {
+    transition_duration_ = value;
+}
+
+void HaDeck::set_transition_memory(uint32_t value) {
+    transition_memory_ = value;
 }
 
-void HaDeck::switch_screen(std::string name) {
-    if (active_screen_ && active_screen_->get_name() == name)
+void HaDeck::add_swipe_screen(uint8_t index) {
+    swipe_screens_.push_back(index);
+}
+
+void HaDeck::set_prebuild_memory(uint32_t value) {
+    prebuild_memory_ = value;
+}
+
+uint32_t HaDeck::get_prebuild_hits() {
+    return prebuild_hits_;
+}
+
+uint32_t HaDeck::get_prebuild_misses() {
+    return prebuild_misses_;
+}
+
+void HaDeck::switch_screen(const std::string &name) {
+    auto screen = get_screen(name);
+    if (!screen) {
+        ESP_LOGW(this->TAG, "switch_screen: unknown screen %s", name.c_str());
         return;
-    
-    if (active_screen_) {
-        active_screen_->set_active(false);
-        active_screen_ = nullptr;
     }
-    
-    if (!screens_.count(name))
+    switch_screen(screen->get_index());
+}
+
+void HaDeck::push_screen(const std::string &name) {
+    auto screen = get_screen(name);
+    if (!screen) {
+        ESP_LOGW(this->TAG, "push_screen: unknown screen %s", name.c_str());
+        return;
+    }
+    push_screen(screen->get_index());
+}
+
+void HaDeck::replace_screen(const std::string &name) {
+    auto screen = get_screen(name);
+    if (!screen) {
+        ESP_LOGW(this->TAG, "replace_screen: unknown screen %s", name.c_str());
+        return;
+    }
+    replace_screen(screen->get_index());
+}
+
+void HaDeck::switch_screen(uint8_t index) {
+    if (index >= screens_.size())
+        return;
+
+    // Back to the root, screens on the stack are no longer retained. The target is kept out of the
+    // prebuilt list, navigate_() takes it as it is and doesn't count it as a prebuild hit.
+    auto target = screens_[index];
+    for (auto screen : stack_) {
+        if (screen != target)
+            retire_(screen);
+    }
+    stack_.clear();
+    navigate_(target, false);
+}
+
+void HaDeck::push_screen(uint8_t index) {
+    if (index >= screens_.size())
         return;
 
-    active_screen_ = screens_[name];
-    active_screen_->set_active(true);
+    auto screen = screens_[index];
+    // Already on the stack, going forward to it is going back
+    if (is_retained_(screen)) {
+        unwind_to_(screen);
+        navigate_(screen, false, true);
+        return;
+    }
+    navigate_(screen, true);
+}
+
+void HaDeck::replace_screen(uint8_t index) {
+    if (index >= screens_.size())
+        return;
+
+    auto screen = screens_[index];
+    if (is_retained_(screen))
+        unwind_to_(screen);
+    navigate_(screen, false);
+}
+
+void HaDeck::pop_screen() {
+    if (stack_.empty())
+        return;
+
+    auto screen = stack_.back();
+    stack_.pop_back();
+    navigate_(screen, false, true);
+}
+
+uint8_t HaDeck::get_stack_depth() {
+    return stack_.size();
+}
+
+uint32_t HaDeck::get_retained_memory() {
+    uint32_t total = 0;
+    for (auto screen : stack_) {
+        if (screen->is_built())
+            total += screen->get_memory();
+    }
+    return total;
+}
+
+void HaDeck::navigate_(HaDeckScreen *screen, bool push, bool back) {
+    // Any navigation wins over a swipe still sliding
+    cancel_swipe_();
+
+    if (screen == pending_screen_) {
+        pending_push_ = push;
+        pending_back_ = back;
+        return;
+    }
+
+    // Superseded while still being built
+    if (pending_screen_) {
+        retire_(pending_screen_);
+        pending_screen_ = nullptr;
+    }
+    if (screen == active_screen_) {
+        release_prebuilt_();
+        return;
+    }
+
+    // The active screen stays on display until the new one is complete
+    pending_screen_ = screen;
+    pending_push_ = push;
+    pending_back_ = back;
+    if (is_prebuilt_(screen) || screen == prebuilding_screen_) {
+        prebuild_hits_++;
+        prebuilt_screens_.erase(std::remove(prebuilt_screens_.begin(), prebuilt_screens_.end(), screen),
+            prebuilt_screens_.end());
+        if (screen == prebuilding_screen_)
+            prebuilding_screen_ = nullptr;
+    } else if (!screen->is_built()) {
+        // Screens retained on the stack are neither hits nor misses
+        if (ready_)
+            prebuild_misses_++;
+        pending_screen_->build_begin(lvgl_main_screen_);
+    }
+    ESP_LOGD(this->TAG, "navigate: %s, %s (stack %u, prebuild hits %u, misses %u)", screen->get_name().c_str(),
+        push ? "push" : "switch", stack_.size(), prebuild_hits_, prebuild_misses_);
+    build_pending_screen_();
+}
+
+void HaDeck::trim_retained_() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t free_size = mon.free_size;
+
+    // Oldest first. Evicted screens stay on the stack and are rebuilt when popped.
+    for (auto screen : stack_) {
+        if (get_retained_memory() <= stack_memory_ && free_size >= PREBUILD_RESERVE)
+            return;
+        if (!screen->is_built())
+            continue;
+
+        free_size += screen->get_memory();
+        screen->destroy();
+        ESP_LOGD(this->TAG, "Evicted %s from the stack (%u bytes retained)", screen->get_name().c_str(),
+            get_retained_memory());
+    }
+}
+
+bool HaDeck::is_retained_(HaDeckScreen *screen) {
+    return std::find(stack_.begin(), stack_.end(), screen) != stack_.end();
+}
+
+void HaDeck::unwind_to_(HaDeckScreen *screen) {
+    while (!stack_.empty()) {
+        auto top = stack_.back();
+        stack_.pop_back();
+        if (top == screen)
+            return;
+        retire_(top);
+    }
+}
+
+void HaDeck::retire_(HaDeckScreen *screen) {
+    // Built screens get a chance to stay as prebuilt, release_prebuilt_() decides
+    screen->hide();
+    if (screen->is_built()) {
+        prebuilt_screens_.push_back(screen);
+    } else {
+        screen->destroy();
+    }
+}
+
+void HaDeck::build_pending_screen_() {
+    if (!pending_screen_ || !pending_screen_->build_step(build_budget_))
+        return;
+
+    auto previous = active_screen_;
+    // Swipes slide the live screens and the blank screen fades on its own
+    bool animate = previous && ready_ && transition_ != TRANSITION_NONE && !swipe_to_ && !inactivity_
+        && capture_transition_();
+
+    active_screen_ = pending_screen_;
+    pending_screen_ = nullptr;
+    active_screen_->show();
+
+    // Pushed over screens keep their LVGL objects, scroll position included
+    if (previous && pending_push_) {
+        previous->hide();
+        stack_.push_back(previous);
+        if (stack_.size() > stack_depth_) {
+            retire_(stack_.front());
+            stack_.erase(stack_.begin());
+        }
+        trim_retained_();
+    } else if (previous) {
+        retire_(previous);
+    }
+    release_prebuilt_();
+    if (animate)
+        start_transition_();
     inactivity_timeout_ = active_screen_->get_inactivity() > 0
         ? active_screen_->get_inactivity()
         : inactivity_timeout_default_;
+
+    if (benchmark_) {
+        ESP_LOGI(this->TAG, "Screen %s built in %u ms, %u slice(s)", active_screen_->get_name().c_str(),
+            active_screen_->get_build_time(), active_screen_->get_build_slices());
+    }
+
+    if (!ready_) {
+        ready_ = true;
+        // Lets the device replace the boot splash with the live UI
+        lv_event_send(lvgl_main_screen_, LV_EVENT_READY, nullptr);
+    }
+}
+
+void HaDeck::build_overlay_() {
+    // After the main screen, which is more important for the first frame
+    if (!overlay_ || overlay_->is_built() || pending_screen_)
+        return;
+    if (!overlay_->build_step(build_budget_))
+        return;
+
+    if (!inactivity_ || !inactivity_blank_screen_)
+        overlay_->show();
+    if (benchmark_) {
+        ESP_LOGI(this->TAG, "Overlay built in %u ms, %u slice(s), %u bytes", overlay_->get_build_time(),
+            overlay_->get_build_slices(), overlay_->get_memory());
+    }
+}
+
+bool HaDeck::capture_transition_() {
+#if LV_USE_SNAPSHOT
+    end_transition_();
+
+    uint32_t size = lv_snapshot_buf_size_needed(lvgl_main_screen_, LV_IMG_CF_TRUE_COLOR);
+    if (size * 2 > transition_memory_)
+        return false;
+
+    for (auto &buf : transition_buf_) {
+        buf = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!buf) {
+            end_transition_();
+            return false;
+        }
+    }
+
+    // The whole LVGL screen, so the background matches
+    if (lv_snapshot_take_to_buf(lvgl_main_screen_, LV_IMG_CF_TRUE_COLOR, &transition_dsc_[0],
+            transition_buf_[0], size) != LV_RES_OK) {
+        end_transition_();
+        return false;
+    }
+    transition_back_ = pending_back_;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void HaDeck::start_transition_() {
+#if LV_USE_SNAPSHOT
+    uint32_t size = lv_snapshot_buf_size_needed(lvgl_main_screen_, LV_IMG_CF_TRUE_COLOR);
+    if (lv_snapshot_take_to_buf(lvgl_main_screen_, LV_IMG_CF_TRUE_COLOR, &transition_dsc_[1],
+            transition_buf_[1], size) != LV_RES_OK) {
+        end_transition_();
+        return;
+    }
+
+    // The images cover the screens, so each frame is only a blit of two images
+    for (uint8_t i = 0; i < 2; i++) {
+        transition_img_[i] = lv_img_create(lvgl_main_screen_);
+        lv_img_set_src(transition_img_[i], &transition_dsc_[i]);
+        lv_obj_clear_flag(transition_img_[i], LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_pos(transition_img_[i], 0, 0);
+    }
+    // Otherwise the live widgets under the images are redrawn on every frame
+    active_screen_->hide();
+
+    transition_width_ = lv_obj_get_width(lvgl_main_screen_) * (transition_back_ ? -1 : 1);
+    transition_start_ = millis();
+    transition_frames_ = 0;
+    transition_anim_cb_(this, 0);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, this);
+    lv_anim_set_values(&a, 0, 256);
+    lv_anim_set_time(&a, transition_duration_);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+    lv_anim_set_exec_cb(&a, HaDeck::transition_anim_cb_);
+    lv_anim_set_ready_cb(&a, HaDeck::transition_ready_cb_);
+    lv_anim_start(&a);
+#endif
+}
+
+void HaDeck::end_transition_() {
+    lv_anim_del(this, HaDeck::transition_anim_cb_);
+    // The images exist only while the active screen is hidden for the animation
+    if (transition_img_[0] && active_screen_)
+        active_screen_->show();
+
+    for (uint8_t i = 0; i < 2; i++) {
+        if (transition_img_[i]) {
+            lv_obj_del(transition_img_[i]);
+            transition_img_[i] = nullptr;
+        }
+        heap_caps_free(transition_buf_[i]);
+        transition_buf_[i] = nullptr;
+    }
+}
+
+void HaDeck::transition_anim_cb_(void *var, int32_t value) {
+    auto deck = (HaDeck*)var;
+    auto from = deck->transition_img_[0];
+    auto to = deck->transition_img_[1];
+    if (!from || !to)
+        return;
+
+    // value goes from 0 to 256
+    int32_t offset = deck->transition_width_ * value / 256;
+    switch (deck->transition_) {
+        case TRANSITION_SLIDE:
+            lv_obj_set_x(from, -offset);
+            lv_obj_set_x(to, deck->transition_width_ - offset);
+            break;
+        case TRANSITION_COVER:
+            lv_obj_set_x(to, deck->transition_width_ - offset);
+            break;
+        case TRANSITION_FADE:
+            lv_obj_set_style_img_opa(to, value > 255 ? 255 : value, LV_PART_MAIN | LV_STATE_DEFAULT);
+            break;
+        default:
+            break;
+    }
+}
+
+void HaDeck::transition_ready_cb_(lv_anim_t *a) {
+    auto deck = (HaDeck*)a->var;
+
+    if (deck->benchmark_) {
+        uint32_t elapsed = millis() - deck->transition_start_;
+        ESP_LOGI(deck->TAG, "Transition: %u frames in %u ms, %.1f fps", deck->transition_frames_, elapsed,
+            elapsed > 0 ? deck->transition_frames_ * 1000.0f / elapsed : 0.0f);
+    }
+    // LVGL has already removed the finished anim, this only frees the images
+    deck->end_transition_();
+}
+
+void HaDeck::on_draw_post_end_(lv_event_t *e) {
+    auto deck = (HaDeck*)lv_event_get_user_data(e);
+    // Sent for every redrawn area, a frame is one run of the display's refresh timer
+    auto refr_timer = lv_disp_get_default()->refr_timer;
+    if (!refr_timer || refr_timer->last_run == deck->frame_tick_)
+        return;
+
+    deck->frame_tick_ = refr_timer->last_run;
+    if (deck->transition_img_[0])
+        deck->transition_frames_++;
+    if (deck->swipe_from_)
+        deck->swipe_frames_++;
+}
+
+void HaDeck::on_gesture_(lv_event_t *e) {
+    auto deck = (HaDeck*)lv_event_get_user_data(e);
+    if (deck->swipe_from_ || deck->pending_screen_ || !deck->active_screen_)
+        return;
+
+    auto it = std::find(deck->swipe_screens_.begin(), deck->swipe_screens_.end(),
+        deck->active_screen_->get_index());
+    if (it == deck->swipe_screens_.end())
+        return;
+
+    auto dir = lv_indev_get_gesture_dir(lv_indev_get_act());
+    int8_t step = dir == LV_DIR_LEFT ? 1 : dir == LV_DIR_RIGHT ? -1 : 0;
+    if (step == 0 || (step < 0 && it == deck->swipe_screens_.begin())
+            || (step > 0 && it + 1 == deck->swipe_screens_.end()))
+        return;
+
+    auto target = deck->screens_[*(it + step)];
+    // Neighbours are prebuilt, if one isn't ready yet it's just built in place
+    if (!target->is_built()) {
+        deck->replace_screen(target->get_index());
+        return;
+    }
+
+    deck->swipe_from_ = deck->active_screen_;
+    deck->swipe_to_ = target;
+    deck->swipe_width_ = lv_obj_get_width(deck->lvgl_main_screen_) * step;
+    deck->swipe_start_ = millis();
+    deck->swipe_frames_ = 0;
+    lv_obj_set_x(target->get_container(), deck->swipe_width_);
+    target->show();
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, deck);
+    lv_anim_set_values(&a, 0, deck->swipe_width_);
+    lv_anim_set_time(&a, SWIPE_ANIM_TIME);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+    lv_anim_set_exec_cb(&a, HaDeck::swipe_anim_cb_);
+    lv_anim_set_ready_cb(&a, HaDeck::swipe_ready_cb_);
+    lv_anim_start(&a);
+}
+
+void HaDeck::swipe_anim_cb_(void *var, int32_t value) {
+    auto deck = (HaDeck*)var;
+    // Navigation cancels the slide, so both screens stay built until it ends
+    lv_obj_set_x(deck->swipe_from_->get_container(), -value);
+    lv_obj_set_x(deck->swipe_to_->get_container(), deck->swipe_width_ - value);
+}
+
+void HaDeck::swipe_ready_cb_(lv_anim_t *a) {
+    auto deck = (HaDeck*)a->var;
+    auto from = deck->swipe_from_;
+    deck->swipe_from_ = nullptr;
+
+    // The target is built, so this only swaps the active screen
+    deck->replace_screen(deck->swipe_to_->get_index());
+    lv_obj_set_x(deck->swipe_to_->get_container(), 0);
+    if (from->get_container())
+        lv_obj_set_x(from->get_container(), 0);
+
+    if (deck->benchmark_) {
+        uint32_t elapsed = millis() - deck->swipe_start_;
+        ESP_LOGI(deck->TAG, "Swipe %s -> %s: %u frames in %u ms, %.1f fps", from->get_name().c_str(),
+            deck->swipe_to_->get_name().c_str(), deck->swipe_frames_, elapsed,
+            elapsed > 0 ? deck->swipe_frames_ * 1000.0f / elapsed : 0.0f);
+    }
+    deck->swipe_to_ = nullptr;
+}
+
+void HaDeck::cancel_swipe_() {
+    // Cleared by swipe_ready_cb_() before it navigates itself
+    if (!swipe_from_)
+        return;
+
+    lv_anim_del(this, HaDeck::swipe_anim_cb_);
+    if (auto from = swipe_from_->get_container())
+        lv_obj_set_x(from, 0);
+    if (auto to = swipe_to_->get_container())
+        lv_obj_set_x(to, 0);
+    // Shown again if it's the one being navigated to
+    swipe_to_->hide();
+    swipe_from_ = nullptr;
+    swipe_to_ = nullptr;
+}
+
+void HaDeck::prebuild_screens_() {
+    if (prebuild_memory_ == 0 || !active_screen_ || pending_screen_)
+        return;
+    if (lv_disp_get_inactive_time(NULL) < PREBUILD_IDLE_TIME || lv_anim_count_running() > 0)
+        return;
+
+    if (!prebuilding_screen_) {
+        // Walking the heap isn't cheap, only done once a candidate is found
+        lv_mem_monitor_t mon;
+        bool monitored = false;
+
+        for (auto index : active_screen_->get_navigation_targets()) {
+            auto screen = screens_[index];
+            if (screen == active_screen_ || is_prebuilt_(screen) || is_retained_(screen))
+                continue;
+            // Memory is known once a screen was built, skip those that don't fit
+            if (get_prebuilt_memory_() + screen->get_memory() > prebuild_memory_)
+                continue;
+            if (!monitored) {
+                lv_mem_monitor(&mon);
+                monitored = true;
+            }
+            if (mon.free_size < screen->get_memory() + PREBUILD_RESERVE)
+                continue;
+
+            prebuilding_screen_ = screen;
+            prebuilding_screen_->build_begin(lvgl_main_screen_);
+            break;
+        }
+    }
+
+    if (!prebuilding_screen_ || !prebuilding_screen_->build_step(build_budget_))
+        return;
+
+    auto screen = prebuilding_screen_;
+    prebuilding_screen_ = nullptr;
+    if (get_prebuilt_memory_() + screen->get_memory() > prebuild_memory_) {
+        screen->destroy();
+        return;
+    }
+
+    prebuilt_screens_.push_back(screen);
+    if (benchmark_) {
+        ESP_LOGI(this->TAG, "Screen %s prebuilt in %u ms, %u slice(s), %u bytes", screen->get_name().c_str(),
+            screen->get_build_time(), screen->get_build_slices(), screen->get_memory());
+    }
+}
+
+bool HaDeck::is_prebuilt_(HaDeckScreen *screen) {
+    return std::find(prebuilt_screens_.begin(), prebuilt_screens_.end(), screen) != prebuilt_screens_.end();
+}
+
+bool HaDeck::is_navigation_target_(HaDeckScreen *screen) {
+    if (!active_screen_)
+        return false;
+
+    auto &targets = active_screen_->get_navigation_targets();
+    return std::find(targets.begin(), targets.end(), screen->get_index()) != targets.end();
+}
+
+uint32_t HaDeck::get_prebuilt_memory_() {
+    uint32_t total = 0;
+    for (auto screen : prebuilt_screens_)
+        total += screen->get_memory();
+    return total;
+}
+
+void HaDeck::release_prebuilt_() {
+    // Only targets of the active screen are worth keeping, within the budget
+    uint32_t total = 0;
+    auto it = prebuilt_screens_.begin();
+    while (it != prebuilt_screens_.end()) {
+        auto screen = *it;
+        if (is_navigation_target_(screen) && total + screen->get_memory() <= prebuild_memory_) {
+            total += screen->get_memory();
+            it++;
+            continue;
+        }
+        screen->destroy();
+        it = prebuilt_screens_.erase(it);
+    }
+
+    if (prebuilding_screen_ && !is_navigation_target_(prebuilding_screen_)) {
+        prebuilding_screen_->destroy();
+        prebuilding_screen_ = nullptr;
+    }
+}
+
+void HaDeck::update_settled_() {
+    bool settled = ready_ && active_screen_ && active_screen_->get_index() == main_screen_ && !pending_screen_
+        && stack_.empty() && !swipe_from_ && !transition_img_[0] && !inactivity_;
+    if (settled == lv_obj_has_flag(lvgl_main_screen_, SETTLED_FLAG))
+        return;
+
+    if (settled) {
+        lv_obj_add_flag(lvgl_main_screen_, SETTLED_FLAG);
+    } else {
+        lv_obj_clear_flag(lvgl_main_screen_, SETTLED_FLAG);
+    }
 }
 
 void HaDeck::add_on_inactivity_change_callback(std::function<void(bool)> &&callback) {
@@ -75,13 +698,18 @@ void HaDeck::set_inactivity_(bool value) {
     
     inactivity_ = value;
     if (inactivity_) {
-        switch_screen(main_screen_name_);
+        switch_screen(main_screen_);
         if (inactivity_blank_screen_) {
             lv_scr_load_anim(lvgl_inactivity_screen_, LV_SCR_LOAD_ANIM_FADE_OUT, 300, 0, false);
+            // The top layer is drawn above the blank screen as well
+            if (overlay_)
+                overlay_->hide();
         }
     } else {
         if (inactivity_blank_screen_) {
             lv_scr_load(lvgl_main_screen_);
+            if (overlay_ && overlay_->is_built())
+                overlay_->show();
         }
     }
     inactivity_change_callback_.call(inactivity_);
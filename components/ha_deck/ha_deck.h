@@ -1,39 +1,142 @@
 #pragma once
 
-#include <map>
 #include <string>
+#include <vector>
 #include "ha_deck_screen.h"
+#include "hd_image_cache.h"
 
 namespace esphome {
 namespace ha_deck {
 
+enum HaDeckTransition : uint8_t {
+    TRANSITION_NONE = 0,
+    TRANSITION_SLIDE,
+    TRANSITION_FADE,
+    TRANSITION_COVER,
+};
+
 class HaDeck : public Component
 {
 public:
     void setup() override;
     void loop() override;
     float get_setup_priority() const override;
-    void set_main_screen(std::string value);
+    void set_main_screen(uint8_t index);
     void set_inactivity_period(uint32_t value);
     void set_inactivity_blank_screen(bool value);
     bool get_inactivity();
+    // Screens are indexed in the order they are added, codegen relies on it
     void add_screen(HaDeckScreen *screen);
-    void switch_screen(std::string name);
+    // Clears the navigation stack
+    void switch_screen(uint8_t index);
+    // Keeps the active screen on the stack, pop_screen() returns to it
+    void push_screen(uint8_t index);
+    // Like switch_screen(), but leaves the stack as is
+    void replace_screen(uint8_t index);
+    void pop_screen();
+    // Name based lookup, for lambdas
+    void switch_screen(const std::string &name);
+    void push_screen(const std::string &name);
+    void replace_screen(const std::string &name);
+    HaDeckScreen *get_screen(const std::string &name);
+    // Widgets rendered once on the top layer, above every screen
+    void set_overlay(HaDeckScreen *overlay);
+    void set_build_budget(uint32_t value);
+    void set_benchmark(bool value);
+    void set_stack_depth(uint8_t value);
+    // LVGL memory (bytes) screens on the stack may keep, older ones are evicted
+    void set_stack_memory(uint32_t value);
+    void set_transition(HaDeckTransition value);
+    void set_transition_duration(uint32_t value);
+    void set_transition_memory(uint32_t value);
+    // Ordered screens to move between with horizontal swipes
+    void add_swipe_screen(uint8_t index);
+    void set_prebuild_memory(uint32_t value);
+    void set_image_cache(uint32_t value);
+    uint8_t get_stack_depth();
+    // LVGL memory (bytes) held by screens on the stack
+    uint32_t get_retained_memory();
+    // Switches served from / missing the prebuilt screens
+    uint32_t get_prebuild_hits();
+    uint32_t get_prebuild_misses();
     void add_on_inactivity_change_callback(std::function<void(bool)> &&callback);
 private:
     void set_inactivity_(bool value);
     void create_inactivity_screen_();
+    void navigate_(HaDeckScreen *screen, bool push, bool back = false);
+    bool is_retained_(HaDeckScreen *screen);
+    void trim_retained_();
+    void unwind_to_(HaDeckScreen *screen);
+    void retire_(HaDeckScreen *screen);
+    void build_pending_screen_();
+    void build_overlay_();
+    bool capture_transition_();
+    void start_transition_();
+    void end_transition_();
+    static void transition_anim_cb_(void *var, int32_t value);
+    static void transition_ready_cb_(lv_anim_t *a);
+    static void on_draw_post_end_(lv_event_t *e);
+    static void on_gesture_(lv_event_t *e);
+    static void swipe_anim_cb_(void *var, int32_t value);
+    static void swipe_ready_cb_(lv_anim_t *a);
+    void cancel_swipe_();
+    void prebuild_screens_();
+    bool is_prebuilt_(HaDeckScreen *screen);
+    bool is_navigation_target_(HaDeckScreen *screen);
+    uint32_t get_prebuilt_memory_();
+    void release_prebuilt_();
+    void update_settled_();
 
     const char *TAG = "HA_DECK";
-    std::string main_screen_name_;
+    uint8_t main_screen_ = 0;
     CallbackManager<void(bool)> inactivity_change_callback_{};
     uint32_t inactivity_timeout_default_ = 0;
     bool inactivity_blank_screen_ = false;
     uint32_t inactivity_timeout_ = 0;
     bool inactivity_ = false;
 
-    std::map<std::string, HaDeckScreen*> screens_ = {};
+    std::vector<HaDeckScreen*> screens_ = {};
     HaDeckScreen *active_screen_ = nullptr;
+    // Screen being built, replaces active_screen_ once complete
+    HaDeckScreen *pending_screen_ = nullptr;
+    bool pending_push_ = false;
+    bool pending_back_ = false;
+    // Screens to go back to, the last one is on top
+    std::vector<HaDeckScreen*> stack_ = {};
+    uint8_t stack_depth_ = 5;
+    uint32_t stack_memory_ = 8192;
+
+    // Outgoing and incoming screens are animated as snapshots in PSRAM
+    HaDeckTransition transition_ = TRANSITION_NONE;
+    uint32_t transition_duration_ = 250;
+    uint32_t transition_memory_ = 1048576;
+    bool transition_back_ = false;
+    int32_t transition_width_ = 0;
+    uint32_t transition_start_ = 0;
+    uint32_t transition_frames_ = 0;
+    void *transition_buf_[2] = {nullptr, nullptr};
+    lv_img_dsc_t transition_dsc_[2];
+    lv_obj_t *transition_img_[2] = {nullptr, nullptr};
+
+    std::vector<uint8_t> swipe_screens_ = {};
+    HaDeckScreen *swipe_from_ = nullptr;
+    HaDeckScreen *swipe_to_ = nullptr;
+    int32_t swipe_width_ = 0;
+    uint32_t swipe_start_ = 0;
+    uint32_t swipe_frames_ = 0;
+    // Refresh timer run last counted as a frame, benchmark only
+    uint32_t frame_tick_ = 0;
+    uint32_t build_budget_ = 8000;
+    bool benchmark_ = false;
+    bool ready_ = false;
+
+    // Built and hidden navigation targets of the active screen
+    std::vector<HaDeckScreen*> prebuilt_screens_ = {};
+    HaDeckScreen *prebuilding_screen_ = nullptr;
+    uint32_t prebuild_memory_ = 8192;
+    uint32_t prebuild_hits_ = 0;
+    uint32_t prebuild_misses_ = 0;
+    HaDeckScreen *overlay_ = nullptr;
     lv_obj_t *lvgl_main_screen_ = nullptr;
     lv_obj_t *lvgl_inactivity_screen_ = nullptr;
 };
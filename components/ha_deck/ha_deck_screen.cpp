@@ -1,4 +1,6 @@
 #include "ha_deck_screen.h"
+#include "esphome/core/hal.h"
+#include <algorithm>
 
 namespace esphome {
 namespace ha_deck {
@@ -11,15 +13,23 @@ void HaDeckScreen::loop() {
     
 }
 
-float HaDeckScreen::get_setup_priority() const { return setup_priority::AFTER_CONNECTION; }
+float HaDeckScreen::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 
 void HaDeckScreen::set_name(std::string name) {
     name_ = name;
 }
-std::string HaDeckScreen::get_name() {
+const std::string &HaDeckScreen::get_name() {
     return name_;
 }
 
+void HaDeckScreen::set_index(uint8_t index) {
+    index_ = index;
+}
+
+uint8_t HaDeckScreen::get_index() {
+    return index_;
+}
+
 void HaDeckScreen::set_inactivity(uint32_t inactivity) {
     inactivity_ = inactivity * 1000;
 }
@@ -32,17 +42,114 @@ void HaDeckScreen::add_widget(HaDeckWidget *widget) {
     widgets_.push_back(widget);
 }
 
-void HaDeckScreen::set_active(bool active) {
-    ESP_LOGD(this->TAG, "screen %s, set_active: %d", this->get_name().c_str(), active);
-    active_ = active;
+void HaDeckScreen::add_navigation_target(uint8_t index) {
+    navigation_targets_.push_back(index);
+}
+
+const std::vector<uint8_t> &HaDeckScreen::get_navigation_targets() {
+    return navigation_targets_;
+}
+
+void HaDeckScreen::build_begin(lv_obj_t *parent) {
+    if (build_order_.size() != widgets_.size()) {
+        build_order_.clear();
+        for (uint16_t i = 0; i < widgets_.size(); i++)
+            build_order_.push_back(i);
+        // Explicit priority first, then top-left to bottom-right
+        std::stable_sort(build_order_.begin(), build_order_.end(), [this](uint16_t a, uint16_t b) {
+            auto wa = widgets_[a];
+            auto wb = widgets_[b];
+            if (wa->get_priority() != wb->get_priority())
+                return wa->get_priority() > wb->get_priority();
+            if (wa->get_y() != wb->get_y())
+                return wa->get_y() < wb->get_y();
+            return wa->get_x() < wb->get_x();
+        });
+    }
+
+    destroy();
+
+    // Kept hidden until every widget is rendered, so the first frame is complete
+    lv_container_ = lv_obj_create(parent);
+    lv_obj_remove_style_all(lv_container_);
+    lv_obj_set_size(lv_container_, lv_pct(100), lv_pct(100));
+    lv_obj_add_flag(lv_container_, LV_OBJ_FLAG_HIDDEN);
+
+    build_index_ = 0;
+    build_slices_ = 0;
+    build_start_ = millis();
+    build_mem_start_ = lvgl_mem_used();
+}
+
+bool HaDeckScreen::build_step(uint32_t budget_us) {
+    if (!lv_container_)
+        return false;
+    if (is_built())
+        return true;
 
+    uint32_t start = micros();
+    build_slices_++;
+    // At least one widget per slice, even if it alone exceeds the budget
+    do {
+        widgets_[build_order_[build_index_++]]->render(lv_container_);
+    } while (build_index_ < widgets_.size() && micros() - start < budget_us);
+
+    if (!is_built())
+        return false;
+
+    // Overlapping widgets stack in YAML order, whatever order they were built in.
+    // The container is still hidden, so this doesn't redraw anything.
     for (auto widget : widgets_) {
-        if (active) {
-            widget->render();
-        } else {
-            widget->destroy();
-        }
+        if (widget->get_root())
+            lv_obj_move_foreground(widget->get_root());
     }
+
+    build_time_ = millis() - build_start_;
+    uint32_t used = lvgl_mem_used();
+    memory_ = used > build_mem_start_ ? used - build_mem_start_ : 0;
+    return true;
+}
+
+bool HaDeckScreen::is_built() {
+    return lv_container_ && build_index_ >= widgets_.size();
+}
+
+void HaDeckScreen::show() {
+    if (lv_container_)
+        lv_obj_clear_flag(lv_container_, LV_OBJ_FLAG_HIDDEN);
+}
+
+void HaDeckScreen::hide() {
+    if (lv_container_)
+        lv_obj_add_flag(lv_container_, LV_OBJ_FLAG_HIDDEN);
+}
+
+lv_obj_t *HaDeckScreen::get_container() {
+    return lv_container_;
+}
+
+void HaDeckScreen::destroy() {
+    if (!lv_container_)
+        return;
+
+    for (auto widget : widgets_)
+        widget->destroy();
+
+    lv_obj_del(lv_container_);
+    lv_container_ = nullptr;
+    build_index_ = 0;
+}
+
+uint32_t HaDeckScreen::get_build_time() {
+    return build_time_;
+}
+
+uint32_t HaDeckScreen::get_build_slices() {
+    return build_slices_;
+}
+
+uint32_t HaDeckScreen::get_memory() {
+    return memory_;
 }
 
 }  // namespace ha_deck
@@ -15,19 +15,49 @@ public:
     float get_setup_priority() const override;
 
     void set_name(std::string name);
-    std::string get_name();
+    const std::string &get_name();
+    void set_index(uint8_t index);
+    uint8_t get_index();
     void set_inactivity(uint32_t value);
     uint32_t get_inactivity();
     void add_widget(HaDeckWidget *widget);
+    // Screens this one can switch to, candidates for prebuilding
+    void add_navigation_target(uint8_t index);
+    const std::vector<uint8_t> &get_navigation_targets();
 
-    void set_active(bool active);
+    // Starts building the screen into a hidden container on parent
+    void build_begin(lv_obj_t *parent);
+    // Renders widgets until budget_us is used up, returns true once all are rendered
+    bool build_step(uint32_t budget_us);
+    bool is_built();
+    void show();
+    void hide();
+    lv_obj_t *get_container();
+    void destroy();
+
+    // Duration (ms) and number of slices of the last construction
+    uint32_t get_build_time();
+    uint32_t get_build_slices();
+    // LVGL memory (bytes) taken by the screen when it was last built
+    uint32_t get_memory();
 private:
     const char *TAG = "HD_SCREEN";
     std::string name_;
+    uint8_t index_ = 0;
     uint32_t inactivity_ = 0;
-    bool active_ = false;
     std::vector<HaDeckWidget*> widgets_ = {};
+    // Indexes into widgets_ in build order, widgets_ itself keeps YAML (z-)order
+    std::vector<uint16_t> build_order_ = {};
+    std::vector<uint8_t> navigation_targets_ = {};
+
+    lv_obj_t *lv_container_ = nullptr;
+    size_t build_index_ = 0;
+    uint32_t build_start_ = 0;
+    uint32_t build_time_ = 0;
+    uint32_t build_slices_ = 0;
+    uint32_t build_mem_start_ = 0;
+    uint32_t memory_ = 0;
 };
 
 }  // namespace ha_deck
-}  // namespace esphome
\ No newline at end of file
+}  // namespace esphome
@@ -1,8 +1,21 @@
 #include "ha_deck_widget.h"
+#include "esphome/core/hal.h"
 
 namespace esphome {
 namespace ha_deck {
 
+static const char *const TAG = "HD_WIDGET";
+// Redraws averaged per profiling log line
+static const uint32_t PROFILE_DRAWS = 50;
+
+bool HaDeckWidget::profile_ = false;
+
+uint32_t lvgl_mem_used() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
 void HaDeckWidget::setup() { 
     
 }
@@ -21,7 +34,7 @@ void HaDeckWidget::loop() {
     update_();
 }
 
-float HaDeckWidget::get_setup_priority() const { return setup_priority::AFTER_CONNECTION; }
+float HaDeckWidget::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 
 void HaDeckWidget::set_position(int16_t x, int16_t y) {
     x_ = x;
@@ -33,12 +46,42 @@ void HaDeckWidget::set_dimensions(int16_t w, int16_t h) {
     h_ = h;
 }
 
-void HaDeckWidget::render() {
+void HaDeckWidget::set_priority(int16_t priority) {
+    priority_ = priority;
+}
+
+int16_t HaDeckWidget::get_x() {
+    return x_;
+}
+
+int16_t HaDeckWidget::get_y() {
+    return y_;
+}
+
+int16_t HaDeckWidget::get_priority() {
+    return priority_;
+}
+
+void HaDeckWidget::render(lv_obj_t *parent) {
     if (rendered_)
         return;
 
-    rendered_ = true;    
-    render_();
+    rendered_ = true;
+    parent_ = parent;
+
+    if (profile_) {
+        uint32_t used = lvgl_mem_used();
+        render_();
+        uint32_t after = lvgl_mem_used();
+        memory_ = after > used ? after - used : 0;
+    } else {
+        render_();
+    }
+
+    // The root object is the one render_() just added to parent
+    root_ = lv_obj_get_child_cnt(parent) > 0 ? lv_obj_get_child(parent, -1) : nullptr;
+    if (profile_ && root_)
+        add_profiling_(root_);
 }
 
 void HaDeckWidget::destroy() {
@@ -46,9 +89,14 @@ void HaDeckWidget::destroy() {
         return;
     
     rendered_ = false;
+    root_ = nullptr;
     destroy_();
 }
 
+lv_obj_t *HaDeckWidget::get_root() {
+    return root_;
+}
+
 void HaDeckWidget::set_visible(bool visible) {
     visible_ = visible;
     set_visible_(visible);
@@ -67,5 +115,106 @@ void HaDeckWidget::add_enabled_lambda(std::function<optional<bool>()> &&f) {
     enabled_fn_ = f;
 }
 
+void HaDeckWidget::set_drawn(bool drawn) {
+    drawn_ = drawn;
+}
+
+uint32_t HaDeckWidget::get_memory() {
+    return memory_;
+}
+
+void HaDeckWidget::set_profile(bool profile) {
+    profile_ = profile;
+}
+
+lv_obj_t *HaDeckWidget::create_drawn_obj_(lv_coord_t w, lv_coord_t h) {
+    auto obj = lv_obj_create(parent_);
+    // No theme styles, everything is drawn by draw_()
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x_, y_);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(obj, HaDeckWidget::draw_main_cb_, LV_EVENT_DRAW_MAIN, this);
+    return obj;
+}
+
+void HaDeckWidget::draw_main_cb_(lv_event_t *e) {
+    auto widget = (HaDeckWidget*)lv_event_get_user_data(e);
+    lv_obj_t *obj = lv_event_get_target(e);
+    widget->draw_(lv_event_get_draw_ctx(e), &obj->coords);
+}
+
+void HaDeckWidget::draw_background_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords, lv_color_t color,
+        lv_opa_t opa) {
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.radius = 5;
+    dsc.bg_color = color;
+    dsc.bg_opa = opa;
+    lv_draw_rect(draw_ctx, &dsc, coords);
+}
+
+void HaDeckWidget::draw_text_(lv_draw_ctx_t *draw_ctx, const lv_area_t *area, const char *text,
+        const lv_font_t *font, lv_opa_t opa) {
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.color = lv_color_hex(0xFFFFFF);
+    dsc.font = font;
+    dsc.opa = opa;
+    dsc.align = LV_TEXT_ALIGN_CENTER;
+    lv_draw_label(draw_ctx, &dsc, area, text, nullptr);
+}
+
+lv_coord_t HaDeckWidget::get_text_width_(const char *text, const lv_font_t *font) {
+    lv_point_t size;
+    lv_txt_get_size(&size, text, font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    return size.x;
+}
+
+void HaDeckWidget::draw_button_content_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords, const char *icon,
+        const char *text, lv_opa_t opa) {
+    bool has_icon = icon[0] != '\0';
+    bool has_text = text[0] != '\0';
+    lv_area_t area = *coords;
+    area.y1 += 10;
+    area.y2 -= 10;
+    lv_coord_t middle = (area.y1 + area.y2) / 2;
+
+    if (has_icon) {
+        lv_area_t icon_area = area;
+        icon_area.y1 = has_text ? area.y1 : middle - Material48.line_height / 2;
+        draw_text_(draw_ctx, &icon_area, icon, &Material48, opa);
+    }
+    if (has_text) {
+        lv_area_t text_area = area;
+        text_area.y1 = has_icon ? area.y2 - Font16.line_height + 1 : middle - Font16.line_height / 2;
+        draw_text_(draw_ctx, &text_area, text, &Font16, opa);
+    }
+}
+
+void HaDeckWidget::add_profiling_(lv_obj_t *root) {
+    // POST_END comes after the children, so object trees are measured as a whole
+    lv_obj_add_event_cb(root, HaDeckWidget::draw_begin_cb_, LV_EVENT_DRAW_MAIN_BEGIN, this);
+    lv_obj_add_event_cb(root, HaDeckWidget::draw_end_cb_, LV_EVENT_DRAW_POST_END, this);
+}
+
+void HaDeckWidget::draw_begin_cb_(lv_event_t *e) {
+    auto widget = (HaDeckWidget*)lv_event_get_user_data(e);
+    widget->draw_start_ = micros();
+}
+
+void HaDeckWidget::draw_end_cb_(lv_event_t *e) {
+    auto widget = (HaDeckWidget*)lv_event_get_user_data(e);
+    widget->draw_time_ += micros() - widget->draw_start_;
+    if (++widget->draw_count_ < PROFILE_DRAWS)
+        return;
+
+    ESP_LOGI(TAG, "Widget at %d,%d (%s): %u bytes, %u us per redraw", widget->x_, widget->y_,
+        widget->drawn_ ? "drawn" : "objects", widget->memory_, widget->draw_time_ / widget->draw_count_);
+    widget->draw_time_ = 0;
+    widget->draw_count_ = 0;
+}
+
 }  // namespace ha_deck
 }  // namespace esphome
\ No newline at end of file
@@ -15,6 +15,9 @@ LV_FONT_DECLARE(Material48);
 namespace esphome {
 namespace ha_deck {
 
+// Bytes of the LVGL heap in use
+uint32_t lvgl_mem_used();
+
 class HaDeckWidget : public Component
 {
 public:
@@ -24,30 +27,69 @@ public:
 
     void set_position(int16_t x, int16_t y);
     void set_dimensions(int16_t w, int16_t h);
-    void render();
+    void set_priority(int16_t priority);
+    int16_t get_x();
+    int16_t get_y();
+    int16_t get_priority();
+    void render(lv_obj_t *parent);
     void destroy();
+    // Object render_() added to the parent, nullptr while not rendered
+    lv_obj_t *get_root();
     void set_visible(bool visible);
     void set_enabled(bool enabled);
 
     void add_enabled_lambda(std::function<optional<bool>()> &&f);
     void add_visible_lambda(std::function<optional<bool>()> &&f);
+
+    // Draw with a single LVGL object instead of an object tree, where supported
+    void set_drawn(bool drawn);
+    // LVGL memory (bytes) taken by the widget when it was last rendered, measured while profiling
+    uint32_t get_memory();
+    // Logs memory and redraw time of every widget
+    static void set_profile(bool profile);
 protected:
     virtual void update_() = 0;
     virtual void render_() = 0;
     virtual void destroy_() = 0;
     virtual void set_visible_(bool visible) = 0;
     virtual void set_enabled_(bool enabled) = 0;
-    
+    // Custom drawing of the single object created by create_drawn_obj_()
+    virtual void draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords) {}
+
+    lv_obj_t *create_drawn_obj_(lv_coord_t w, lv_coord_t h);
+    static void draw_background_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords, lv_color_t color, lv_opa_t opa);
+    static void draw_text_(lv_draw_ctx_t *draw_ctx, const lv_area_t *area, const char *text,
+        const lv_font_t *font, lv_opa_t opa);
+    static lv_coord_t get_text_width_(const char *text, const lv_font_t *font);
+    // Icon on top and text at the bottom, or either one centered
+    static void draw_button_content_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords, const char *icon,
+        const char *text, lv_opa_t opa);
+
     int16_t x_ = 0;
     int16_t y_ = 0;
     int16_t w_ = 0;
     int16_t h_ = 0;
+    int16_t priority_ = 0;
     bool visible_ = true;
     bool enabled_ = false;
     bool rendered_ = false;
+    lv_obj_t *parent_ = nullptr;
+    bool drawn_ = false;
+    static bool profile_;
 
     std::function<optional<bool>()> visible_fn_ = nullptr;
     std::function<optional<bool>()> enabled_fn_ = nullptr;
+private:
+    void add_profiling_(lv_obj_t *root);
+    static void draw_main_cb_(lv_event_t *e);
+    static void draw_begin_cb_(lv_event_t *e);
+    static void draw_end_cb_(lv_event_t *e);
+
+    lv_obj_t *root_ = nullptr;
+    uint32_t memory_ = 0;
+    uint32_t draw_start_ = 0;
+    uint32_t draw_time_ = 0;
+    uint32_t draw_count_ = 0;
 };
 
 }  // namespace ha_deck
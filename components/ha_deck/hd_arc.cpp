@@ -0,0 +1,206 @@
+#include "hd_arc.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace ha_deck {
+
+// 270 degree arc open at the bottom, angles are clockwise from 3 o'clock
+static const uint16_t ARC_START = 135;
+static const uint16_t ARC_SWEEP = 270;
+static const lv_coord_t ARC_WIDTH = 10;
+
+void HdArc::set_text(std::string text) {
+    text_ = text;
+}
+
+void HdArc::set_unit(std::string unit) {
+    unit_ = unit;
+}
+
+void HdArc::set_min(float min) {
+    min_ = min;
+}
+
+void HdArc::set_max(float max) {
+    max_ = max;
+}
+
+void HdArc::set_accuracy_decimals(uint8_t decimals) {
+    accuracy_decimals_ = decimals;
+}
+
+float HdArc::get_value() {
+    return value_;
+}
+
+void HdArc::set_value(float value) {
+    float old_value = value_;
+    value_ = value;
+    char text[sizeof(value_text_)];
+    format_value_(text, sizeof(text));
+    bool text_changed = strcmp(text, value_text_) != 0;
+    strcpy(value_text_, text);
+
+    if (!lv_main_)
+        return;
+
+    // Only the part of the indicator between the old and the new angle changes
+    uint16_t from = value_to_angle_(old_value);
+    uint16_t to = value_to_angle_(value_);
+    uint32_t invalidated = 0;
+    if (from != to) {
+        lv_point_t center;
+        lv_coord_t radius;
+        get_center_(&lv_main_->coords, &center, &radius);
+        // Sweep offsets compare correctly across 360
+        uint16_t a = (from + 360 - ARC_START) % 360 < (to + 360 - ARC_START) % 360 ? from : to;
+        uint16_t b = a == from ? to : from;
+        lv_area_t area;
+        lv_draw_arc_get_area(center.x, center.y, radius, a, b, ARC_WIDTH, true, &area);
+        lv_obj_invalidate_area(lv_main_, &area);
+        invalidated += lv_area_get_size(&area);
+    }
+    if (text_changed) {
+        lv_area_t area;
+        get_value_area_(&lv_main_->coords, &area);
+        lv_obj_invalidate_area(lv_main_, &area);
+        invalidated += lv_area_get_size(&area);
+    }
+
+    if (profile_) {
+        ESP_LOGI(this->TAG, "Arc at %d,%d: %u px invalidated of %u px", x_, y_, invalidated,
+            lv_area_get_size(&lv_main_->coords));
+    }
+}
+
+void HdArc::format_value_(char *buf, size_t size) {
+    // Sources publish after the UI is up, show a placeholder until then
+    if (std::isnan(value_)) {
+        snprintf(buf, size, "-");
+        return;
+    }
+    snprintf(buf, size, "%.*f", accuracy_decimals_, value_);
+}
+
+uint16_t HdArc::value_to_angle_(float value) {
+    if (std::isnan(value) || max_ <= min_)
+        return ARC_START;
+    float ratio = std::max(0.0f, std::min(1.0f, (value - min_) / (max_ - min_)));
+    return (ARC_START + (uint16_t)lroundf(ratio * ARC_SWEEP)) % 360;
+}
+
+void HdArc::get_center_(const lv_area_t *coords, lv_point_t *center, lv_coord_t *radius) {
+    center->x = (coords->x1 + coords->x2) / 2;
+    center->y = (coords->y1 + coords->y2) / 2;
+    *radius = std::min(lv_area_get_width(coords), lv_area_get_height(coords)) / 2 - 4;
+}
+
+void HdArc::get_value_area_(const lv_area_t *coords, lv_area_t *area) {
+    // Inside the arc, centered
+    lv_point_t center;
+    lv_coord_t radius;
+    get_center_(coords, &center, &radius);
+    lv_coord_t half = radius - ARC_WIDTH - 2;
+    area->x1 = center.x - half;
+    area->x2 = center.x + half;
+    area->y1 = center.y - Font24.line_height / 2;
+    area->y2 = area->y1 + Font24.line_height - 1;
+}
+
+void HdArc::render_() {
+    lv_main_ = create_drawn_obj_(w_ > 0 ? w_ : 110, h_ > 0 ? h_ : 96);
+    lv_obj_clear_flag(lv_main_, LV_OBJ_FLAG_CLICKABLE);
+
+    set_visible(visible_);
+    set_enabled(enabled_);
+}
+
+void HdArc::draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords) {
+    lv_point_t center;
+    lv_coord_t radius;
+    get_center_(coords, &center, &radius);
+    bool disabled = lv_obj_has_state(lv_main_, LV_STATE_DISABLED);
+
+    lv_draw_arc_dsc_t dsc;
+    lv_draw_arc_dsc_init(&dsc);
+    dsc.width = ARC_WIDTH;
+    dsc.rounded = 1;
+    dsc.color = lv_color_hex(0x999999);
+    dsc.opa = 25;
+    lv_draw_arc(draw_ctx, &dsc, &center, radius, ARC_START, (ARC_START + ARC_SWEEP) % 360);
+
+    uint16_t angle = value_to_angle_(value_);
+    if (angle != ARC_START) {
+        dsc.color = lv_color_hex(0xFCD663);
+        dsc.opa = disabled ? 100 : LV_OPA_COVER;
+        lv_draw_arc(draw_ctx, &dsc, &center, radius, ARC_START, angle);
+    }
+
+    // Value and unit are centered as a group and share the bottom line
+    lv_area_t row;
+    get_value_area_(coords, &row);
+    lv_coord_t value_w = get_text_width_(value_text_, &Font24);
+    lv_coord_t unit_w = unit_.empty() ? 0 : get_text_width_(unit_.c_str(), &Font16) + 2;
+    lv_coord_t x = (row.x1 + row.x2 - value_w - unit_w) / 2;
+
+    lv_area_t area = {x, row.y1, (lv_coord_t)(x + value_w), row.y2};
+    draw_text_(draw_ctx, &area, value_text_, &Font24, LV_OPA_COVER);
+    if (!unit_.empty()) {
+        area = {(lv_coord_t)(x + value_w + 2), (lv_coord_t)(row.y2 - Font16.line_height + 1),
+            (lv_coord_t)(x + value_w + unit_w), row.y2};
+        draw_text_(draw_ctx, &area, unit_.c_str(), &Font16, LV_OPA_COVER);
+    }
+
+    // Text in the opening at the bottom
+    if (!text_.empty()) {
+        area = *coords;
+        area.y1 = area.y2 - Font16.line_height + 1;
+        draw_text_(draw_ctx, &area, text_.c_str(), &Font16, LV_OPA_COVER);
+    }
+}
+
+void HdArc::destroy_() {
+    lv_obj_del(lv_main_);
+    lv_main_ = nullptr;
+}
+
+void HdArc::update_() {
+    if (this->value_fn_) {
+        auto s = this->value_fn_();
+        if (s.has_value() && s.value() != this->value_ && !(std::isnan(s.value()) && std::isnan(this->value_)))
+            this->set_value(s.value());
+    }
+}
+
+void HdArc::set_visible_(bool visible) {
+    if (!lv_main_)
+        return;
+
+    if (visible) {
+        lv_obj_clear_flag(lv_main_, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(lv_main_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void HdArc::set_enabled_(bool enabled) {
+    if (!lv_main_)
+        return;
+
+    if (enabled) {
+        lv_obj_clear_state(lv_main_, LV_STATE_DISABLED);
+    } else {
+        lv_obj_add_state(lv_main_, LV_STATE_DISABLED);
+    }
+    lv_obj_invalidate(lv_main_);
+}
+
+void HdArc::add_value_lambda(std::function<optional<float>()> &&f) {
+    this->value_fn_ = f;
+}
+
+}  // namespace ha_deck
+}  // namespace esphome
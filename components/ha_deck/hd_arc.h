@@ -0,0 +1,49 @@
+#pragma once
+
+#include "ha_deck_widget.h"
+
+namespace esphome {
+namespace ha_deck {
+
+// Gauge drawn as a single object, value changes redraw only the swept part of the arc
+class HdArc : public HaDeckWidget
+{
+public:
+    void set_text(std::string text);
+    void set_unit(std::string unit);
+    void set_min(float min);
+    void set_max(float max);
+    void set_accuracy_decimals(uint8_t decimals);
+    void set_value(float value);
+    float get_value();
+
+    void add_value_lambda(std::function<optional<float>()> &&f);
+protected:
+    void render_();
+    void destroy_();
+    void update_();
+    void set_visible_(bool visible);
+    void set_enabled_(bool enabled);
+    void draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords);
+private:
+    void get_center_(const lv_area_t *coords, lv_point_t *center, lv_coord_t *radius);
+    void get_value_area_(const lv_area_t *coords, lv_area_t *area);
+    uint16_t value_to_angle_(float value);
+    void format_value_(char *buf, size_t size);
+
+    const char *TAG = "HD_ARC";
+    std::string text_;
+    std::string unit_;
+    float min_ = 0;
+    float max_ = 100;
+    uint8_t accuracy_decimals_ = 0;
+    float value_ = NAN;
+    char value_text_[16] = "-";
+
+    lv_obj_t *lv_main_ = nullptr;
+
+    std::function<optional<float>()> value_fn_ = nullptr;
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,50 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_ID,
+    CONF_ACCURACY_DECIMALS,
+)
+
+from .ha_deck import ha_deck_ns, HaDeckWidget
+
+HdArc = ha_deck_ns.class_("HdArc", HaDeckWidget)
+
+CONF_TEXT = "text"
+CONF_UNIT = "unit"
+CONF_MIN = "min"
+CONF_MAX = "max"
+CONF_VALUE = "value"
+
+def validate_arc_range(config):
+    if config[CONF_MIN] >= config[CONF_MAX]:
+        raise cv.Invalid(f"{CONF_MIN} has to be less than {CONF_MAX}")
+    return config
+
+ARC_CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_ID): cv.declare_id(HdArc),
+        cv.Optional(CONF_TEXT): cv.string,
+        cv.Optional(CONF_UNIT): cv.string,
+        cv.Optional(CONF_MIN, default=0): cv.float_,
+        cv.Optional(CONF_MAX, default=100): cv.float_,
+        cv.Optional(CONF_ACCURACY_DECIMALS, default=0): cv.int_range(min=0, max=3),
+        cv.Optional(CONF_VALUE): cv.returning_lambda,
+    }
+)
+
+async def build_arc(var, config):
+    if text := config.get(CONF_TEXT):
+        cg.add(var.set_text(text))
+
+    if unit := config.get(CONF_UNIT):
+        cg.add(var.set_unit(unit))
+
+    cg.add(var.set_min(config[CONF_MIN]))
+    cg.add(var.set_max(config[CONF_MAX]))
+    cg.add(var.set_accuracy_decimals(config[CONF_ACCURACY_DECIMALS]))
+
+    if CONF_VALUE in config:
+        val = await cg.process_lambda(
+                config[CONF_VALUE], [], return_type=cg.optional.template(float)
+            )
+        cg.add(var.add_value_lambda(val))
@@ -1,8 +1,14 @@
 #include "hd_button.h"
+#include <esp_heap_caps.h>
 
 namespace esphome {
 namespace ha_deck {
 
+// Space between the end of the text and its next repetition
+static const lv_coord_t MARQUEE_GAP = 32;
+// Pixels per second, same as LVGL's label scroll
+static const uint32_t MARQUEE_SPEED = 25;
+
 void HdButton::set_text(std::string text) {
     text_ = text;
 }
@@ -15,6 +21,10 @@ void HdButton::set_toggle(bool toggle) {
     toggle_ = toggle;
 }
 
+void HdButton::set_text_scroll(HdTextScroll text_scroll) {
+    text_scroll_ = text_scroll;
+}
+
 bool HdButton::is_checked() {
     return checked_;
 }
@@ -39,16 +49,25 @@ void HdButton::add_on_long_press_callback(std::function<void()> &&callback) {
     this->long_press_callback_.add(std::move(callback));
 }
 
+void HdButton::add_event_cbs_() {
+    lv_obj_add_event_cb(button_, HdButton::on_click_, LV_EVENT_SHORT_CLICKED, this);
+    lv_obj_add_event_cb(button_, HdButton::on_long_press_, LV_EVENT_LONG_PRESSED, this);
+    lv_obj_add_event_cb(button_, HdButton::on_released_, LV_EVENT_RELEASED, this);
+}
+
 void HdButton::render_() {
+    if (drawn_) {
+        render_drawn_();
+        return;
+    }
+
     lv_obj_t *icon;
     lv_obj_t *label;
 
-    button_ = lv_btn_create(lv_scr_act());
+    button_ = lv_btn_create(parent_);
 
     lv_obj_add_state(button_, LV_STATE_DISABLED);
-    lv_obj_add_event_cb(button_, HdButton::on_click_, LV_EVENT_SHORT_CLICKED, this);
-    lv_obj_add_event_cb(button_, HdButton::on_long_press_, LV_EVENT_LONG_PRESSED, this);
-    lv_obj_add_event_cb(button_, HdButton::on_released_, LV_EVENT_RELEASED, this);
+    add_event_cbs_();
 
     lv_obj_set_height(button_, h_ > 0 ? h_ : 96);
     lv_obj_set_width(button_, w_ > 0 ? w_ : 110);
@@ -98,6 +117,88 @@ void HdButton::render_() {
         lv_obj_set_align(label, has_icon ? LV_ALIGN_BOTTOM_MID : LV_ALIGN_CENTER);
         lv_label_set_text(label, text_.c_str());
         lv_obj_set_style_text_font(label, &Font16, LV_PART_MAIN | LV_STATE_DEFAULT);
+        setup_text_scroll_(label, (w_ > 0 ? w_ : 110) - 20);
+    }
+
+    set_visible(visible_);
+    set_enabled(enabled_);
+    if (toggle_) {
+        lv_obj_add_flag(button_, LV_OBJ_FLAG_CHECKABLE);
+        set_checked_(checked_);
+    }
+}
+
+void HdButton::setup_text_scroll_(lv_obj_t *label, lv_coord_t width) {
+    if (text_scroll_ == TEXT_SCROLL_NONE || get_text_width_(text_.c_str(), &Font16) <= width)
+        return;
+
+    if (text_scroll_ == TEXT_SCROLL_LABEL) {
+        lv_obj_set_width(label, width);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_SCROLL_CIRCULAR);
+        return;
+    }
+
+#if LV_USE_SNAPSHOT
+    // The label is drawn once into an image and deleted before it's ever shown
+    lv_obj_set_style_pad_right(label, MARQUEE_GAP, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_update_layout(label);
+    uint32_t size = lv_snapshot_buf_size_needed(label, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    marquee_buf_ = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!marquee_buf_)
+        marquee_buf_ = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    // Snapshot in the default state, set_enabled_() dims the image instead
+    lv_obj_clear_state(button_, LV_STATE_DISABLED);
+    lv_res_t res = marquee_buf_ ? lv_snapshot_take_to_buf(label, LV_IMG_CF_TRUE_COLOR_ALPHA, &marquee_dsc_,
+            marquee_buf_, size) : LV_RES_INV;
+    lv_obj_add_state(button_, LV_STATE_DISABLED);
+    if (res != LV_RES_OK) {
+        ESP_LOGW(this->TAG, "Can't cache the text of %s, %u bytes", text_.c_str(), size);
+        heap_caps_free(marquee_buf_);
+        marquee_buf_ = nullptr;
+        lv_obj_set_style_pad_right(label, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+        lv_obj_set_width(label, width);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_SCROLL_CIRCULAR);
+        return;
+    }
+
+    auto align = lv_obj_get_style_align(label, LV_PART_MAIN);
+    lv_obj_del(label);
+    marquee_ = lv_img_create(button_);
+    lv_img_set_src(marquee_, &marquee_dsc_);
+    lv_obj_set_size(marquee_, width, marquee_dsc_.header.h);
+    lv_obj_set_align(marquee_, align);
+    // Started in update_() once the screen is shown
+#endif
+}
+
+void HdButton::start_marquee_() {
+    // Wraps around, so moving by the image's width repeats seamlessly
+    lv_coord_t offset = lv_img_get_offset_x(marquee_);
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, marquee_);
+    lv_anim_set_exec_cb(&a, HdButton::marquee_anim_cb_);
+    lv_anim_set_values(&a, offset, offset - marquee_dsc_.header.w);
+    lv_anim_set_time(&a, marquee_dsc_.header.w * 1000 / MARQUEE_SPEED);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_start(&a);
+}
+
+void HdButton::marquee_anim_cb_(void *var, int32_t value) {
+    lv_img_set_offset_x((lv_obj_t *)var, value);
+}
+
+void HdButton::render_drawn_() {
+    button_ = create_drawn_obj_(w_ > 0 ? w_ : 110, h_ > 0 ? h_ : 96);
+    lv_obj_add_flag(button_, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
+    add_event_cbs_();
+    // Without styles LVGL doesn't redraw on state changes by itself
+    static const lv_event_code_t redraw_events[] = {
+        LV_EVENT_PRESSED, LV_EVENT_RELEASED, LV_EVENT_PRESS_LOST, LV_EVENT_VALUE_CHANGED,
+    };
+    for (auto code : redraw_events) {
+        lv_obj_add_event_cb(button_, [](lv_event_t *e) { lv_obj_invalidate(lv_event_get_target(e)); },
+            code, nullptr);
     }
 
     set_visible(visible_);
@@ -108,12 +209,43 @@ void HdButton::render_() {
     }
 }
 
+void HdButton::draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords) {
+    // Same look as the object tree in render_()
+    auto state = lv_obj_get_state(button_);
+    bool checked = state & LV_STATE_CHECKED;
+    bool disabled = state & LV_STATE_DISABLED;
+    lv_opa_t bg_opa = disabled ? 5 : checked ? 125 : state & LV_STATE_PRESSED ? 60 : 25;
+    draw_background_(draw_ctx, coords, lv_color_hex(checked ? 0xFCD663 : 0x999999), bg_opa);
+
+    draw_button_content_(draw_ctx, coords, icon_.c_str(), text_.c_str(), disabled ? 150 : LV_OPA_COVER);
+}
+
 void HdButton::destroy_() {
+    if (marquee_) {
+        lv_anim_del(marquee_, HdButton::marquee_anim_cb_);
+        marquee_ = nullptr;
+    }
     lv_obj_del(button_);
     button_ = nullptr;
+    if (marquee_buf_) {
+        heap_caps_free(marquee_buf_);
+        marquee_buf_ = nullptr;
+    }
 }
 
 void HdButton::update_() {
+    if (marquee_) {
+        // Only scrolls while it can be seen, not on hidden screens or the blank screen
+        auto screen = lv_obj_get_screen(marquee_);
+        bool shown = (screen == lv_scr_act() || screen == lv_layer_top()) && lv_obj_is_visible(marquee_);
+        bool running = lv_anim_get(marquee_, HdButton::marquee_anim_cb_) != nullptr;
+        if (shown && !running) {
+            start_marquee_();
+        } else if (!shown && running) {
+            lv_anim_del(marquee_, HdButton::marquee_anim_cb_);
+        }
+    }
+
     if (this->checked_fn_) {
         auto s = this->checked_fn_();
         if (s.has_value() && s.value() != this->checked_) {
@@ -142,6 +274,10 @@ void HdButton::set_enabled_(bool enabled) {
     } else {
         lv_obj_add_state(button_, LV_STATE_DISABLED);
     }
+    if (marquee_)
+        lv_obj_set_style_img_opa(marquee_, enabled ? LV_OPA_COVER : 150, LV_PART_MAIN | LV_STATE_DEFAULT);
+    if (drawn_)
+        lv_obj_invalidate(button_);
 }
 
 void HdButton::set_checked_(bool checked) {
@@ -155,6 +291,8 @@ void HdButton::set_checked_(bool checked) {
     } else {
         lv_obj_clear_state(button_, LV_STATE_CHECKED);
     }
+    if (drawn_)
+        lv_obj_invalidate(button_);
 }
 
 void HdButton::on_click_(lv_event_t *e) {
@@ -5,12 +5,22 @@
 namespace esphome {
 namespace ha_deck {
 
+// What happens to text wider than the button
+enum HdTextScroll : uint8_t {
+    TEXT_SCROLL_NONE = 0,
+    // LVGL's circular label scroll, the glyphs are rendered on every frame
+    TEXT_SCROLL_LABEL,
+    // Rendered once into an image that is moved by its offset
+    TEXT_SCROLL_CACHED,
+};
+
 class HdButton : public HaDeckWidget
 {
 public:
     void set_text(std::string text);
     void set_icon(std::string icon);
     void set_toggle(bool toggle);
+    void set_text_scroll(HdTextScroll text_scroll);
     bool is_checked();
 
     void add_checked_lambda(std::function<optional<bool>()> &&f);
@@ -24,7 +34,13 @@ protected:
     void update_();
     void set_visible_(bool visible);
     void set_enabled_(bool enabled);
+    void draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords);
 private:
+    void render_drawn_();
+    void setup_text_scroll_(lv_obj_t *label, lv_coord_t width);
+    void start_marquee_();
+    static void marquee_anim_cb_(void *var, int32_t value);
+    void add_event_cbs_();
     static void on_click_(lv_event_t *e);
     static void on_long_press_(lv_event_t *e);
     static void on_released_(lv_event_t *e);
@@ -37,7 +53,11 @@ private:
     bool long_pressed_ = false;
     std::string text_;
     std::string icon_;
-    lv_obj_t *button_;
+    lv_obj_t *button_ = nullptr;
+    HdTextScroll text_scroll_ = TEXT_SCROLL_NONE;
+    lv_obj_t *marquee_ = nullptr;
+    void *marquee_buf_ = nullptr;
+    lv_img_dsc_t marquee_dsc_;
 
     std::function<optional<bool>()> checked_fn_ = nullptr;
     CallbackManager<void()> click_callback_{};
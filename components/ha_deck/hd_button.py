@@ -11,6 +11,12 @@ from esphome.const import (
 from .ha_deck import ha_deck_ns, HaDeckWidget
 
 HdButton = ha_deck_ns.class_("HdButton", HaDeckWidget)
+HdTextScroll = ha_deck_ns.enum("HdTextScroll")
+TEXT_SCROLLS = {
+    "none": HdTextScroll.TEXT_SCROLL_NONE,
+    "label": HdTextScroll.TEXT_SCROLL_LABEL,
+    "cached": HdTextScroll.TEXT_SCROLL_CACHED,
+}
 ClickAction = ha_deck_ns.class_("ClickAction", automation.Action)
 TurnOnAction = ha_deck_ns.class_("TurnOnAction", automation.Action)
 TurnOffAction = ha_deck_ns.class_("TurnOffAction", automation.Action)
@@ -34,6 +40,8 @@ CONF_TEXT = "text"
 CONF_TOGGLE = "toggle"
 CONF_CHECKED = "checked"
 CONF_ON_CLICK = "on_click"
+CONF_DRAWN = "drawn"
+CONF_TEXT_SCROLL = "text_scroll"
 CONF_ON_TURN_ON = "on_turn_on"
 CONF_ON_TURN_OFF = "on_turn_off"
 CONF_ON_LONG_PRESS = "on_long_press"
@@ -45,6 +53,8 @@ BUTTON_CONFIG_SCHEMA = cv.Schema(
         cv.Optional(CONF_ICON): cv.string,
         cv.Optional(CONF_TOGGLE): cv.boolean,
         cv.Optional(CONF_CHECKED): cv.returning_lambda,
+        cv.Optional(CONF_DRAWN, default=False): cv.boolean,
+        cv.Optional(CONF_TEXT_SCROLL, default="none"): cv.enum(TEXT_SCROLLS, lower=True),
         cv.Optional(CONF_ON_CLICK): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ButtonClickTrigger),
@@ -75,6 +85,9 @@ async def build_button(var, config):
         cg.add(var.set_icon(icon))
     if toggle := config.get(CONF_TOGGLE):
         cg.add(var.set_toggle(toggle))
+    if config[CONF_DRAWN]:
+        cg.add(var.set_drawn(True))
+    cg.add(var.set_text_scroll(config[CONF_TEXT_SCROLL]))
     
     if CONF_CHECKED in config:
         checked = await cg.process_lambda(
@@ -0,0 +1,212 @@
+#include "hd_button_grid.h"
+
+namespace esphome {
+namespace ha_deck {
+
+void HdButtonGrid::set_columns(uint8_t columns) {
+    columns_ = columns;
+}
+
+void HdButtonGrid::add_button(std::string text, std::string icon, bool toggle) {
+    Button button;
+    button.text = text;
+    button.icon = icon;
+    button.toggle = toggle;
+    buttons_.push_back(std::move(button));
+}
+
+bool HdButtonGrid::is_checked(uint8_t index) {
+    return index < buttons_.size() && buttons_[index].checked;
+}
+
+void HdButtonGrid::add_checked_lambda(uint8_t index, std::function<optional<bool>()> &&f) {
+    buttons_[index].checked_fn = f;
+}
+
+void HdButtonGrid::add_on_click_callback(uint8_t index, std::function<void()> &&callback) {
+    this->buttons_[index].click_callback.add(std::move(callback));
+}
+
+void HdButtonGrid::add_on_turn_on_callback(uint8_t index, std::function<void()> &&callback) {
+    this->buttons_[index].turn_on_callback.add(std::move(callback));
+}
+
+void HdButtonGrid::add_on_turn_off_callback(uint8_t index, std::function<void()> &&callback) {
+    this->buttons_[index].turn_off_callback.add(std::move(callback));
+}
+
+void HdButtonGrid::add_on_long_press_callback(uint8_t index, std::function<void()> &&callback) {
+    this->buttons_[index].long_press_callback.add(std::move(callback));
+}
+
+void HdButtonGrid::render_() {
+    // Labels are drawn in on_draw_part_end_, the map only defines the layout
+    // A partial last row is padded with hidden buttons so its cells line up with the rows above
+    uint8_t rows = (buttons_.size() + columns_ - 1) / columns_;
+    size_t cells = rows * columns_;
+    map_.clear();
+    for (size_t i = 0; i < cells; i++) {
+        if (i > 0 && i % columns_ == 0)
+            map_.push_back("\n");
+        map_.push_back(" ");
+    }
+    map_.push_back("");
+
+    matrix_ = lv_btnmatrix_create(parent_);
+    lv_btnmatrix_set_map(matrix_, map_.data());
+    lv_obj_add_state(matrix_, LV_STATE_DISABLED);
+
+    lv_obj_set_width(matrix_, w_ > 0 ? w_ : columns_ * 118 - 8);
+    lv_obj_set_height(matrix_, h_ > 0 ? h_ : rows * 104 - 8);
+    lv_obj_align(matrix_, LV_ALIGN_TOP_LEFT, x_, y_);
+    lv_obj_add_flag(matrix_, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
+
+    lv_obj_set_style_bg_opa(matrix_, LV_OPA_TRANSP, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(matrix_, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_outline_width(matrix_, 0, LV_PART_MAIN | LV_STATE_FOCUS_KEY);
+    lv_obj_set_style_pad_all(matrix_, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_row(matrix_, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_column(matrix_, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    lv_obj_set_style_shadow_width(matrix_, 0, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(matrix_, 0, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_radius(matrix_, 5, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_color(matrix_, lv_color_hex(0x999999), LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(matrix_, 25, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_color(matrix_, lv_color_hex(0x999999), LV_PART_ITEMS | LV_STATE_PRESSED);
+    lv_obj_set_style_bg_opa(matrix_, 60, LV_PART_ITEMS | LV_STATE_PRESSED);
+    // Checked
+    lv_obj_set_style_bg_color(matrix_, lv_color_hex(0xFCD663), LV_PART_ITEMS | LV_STATE_CHECKED);
+    lv_obj_set_style_bg_opa(matrix_, 125, LV_PART_ITEMS | LV_STATE_CHECKED);
+    // Disabled
+    lv_obj_set_style_bg_color(matrix_, lv_color_hex(0x999999), LV_PART_ITEMS | LV_STATE_DISABLED);
+    lv_obj_set_style_bg_opa(matrix_, 5, LV_PART_ITEMS | LV_STATE_DISABLED);
+
+    for (size_t i = 0; i < buttons_.size(); i++) {
+        // Fire on release, after a checkable button has been toggled
+        lv_btnmatrix_set_btn_ctrl(matrix_, i, LV_BTNMATRIX_CTRL_CLICK_TRIG | LV_BTNMATRIX_CTRL_NO_REPEAT);
+        if (buttons_[i].toggle) {
+            lv_btnmatrix_set_btn_ctrl(matrix_, i, LV_BTNMATRIX_CTRL_CHECKABLE);
+            set_checked_(i, buttons_[i].checked);
+        }
+    }
+    for (size_t i = buttons_.size(); i < cells; i++)
+        lv_btnmatrix_set_btn_ctrl(matrix_, i, LV_BTNMATRIX_CTRL_HIDDEN);
+
+    lv_obj_add_event_cb(matrix_, HdButtonGrid::on_value_changed_, LV_EVENT_VALUE_CHANGED, this);
+    lv_obj_add_event_cb(matrix_, HdButtonGrid::on_long_press_, LV_EVENT_LONG_PRESSED, this);
+    lv_obj_add_event_cb(matrix_, [](lv_event_t *e) {
+        ((HdButtonGrid*)lv_event_get_user_data(e))->long_pressed_ = false;
+    }, LV_EVENT_PRESSED, this);
+    lv_obj_add_event_cb(matrix_, HdButtonGrid::on_draw_part_end_, LV_EVENT_DRAW_PART_END, this);
+
+    set_visible(visible_);
+    set_enabled(enabled_);
+}
+
+void HdButtonGrid::destroy_() {
+    lv_obj_del(matrix_);
+    matrix_ = nullptr;
+}
+
+void HdButtonGrid::update_() {
+    for (size_t i = 0; i < buttons_.size(); i++) {
+        auto &button = buttons_[i];
+        if (!button.checked_fn)
+            continue;
+        auto s = button.checked_fn();
+        if (s.has_value() && s.value() != button.checked) {
+            set_checked_(i, s.value());
+        }
+    }
+}
+
+void HdButtonGrid::set_visible_(bool visible) {
+    if (!matrix_)
+        return;
+
+    if (visible) {
+        lv_obj_clear_flag(matrix_, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(matrix_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void HdButtonGrid::set_enabled_(bool enabled) {
+    if (!matrix_)
+        return;
+
+    // The items don't inherit the matrix's state, only their own ctrl bits pick the disabled style
+    if (enabled) {
+        lv_obj_clear_state(matrix_, LV_STATE_DISABLED);
+        lv_btnmatrix_clear_btn_ctrl_all(matrix_, LV_BTNMATRIX_CTRL_DISABLED);
+    } else {
+        lv_obj_add_state(matrix_, LV_STATE_DISABLED);
+        lv_btnmatrix_set_btn_ctrl_all(matrix_, LV_BTNMATRIX_CTRL_DISABLED);
+    }
+}
+
+void HdButtonGrid::set_checked_(uint8_t index, bool checked) {
+    buttons_[index].checked = checked;
+
+    if (!matrix_)
+        return;
+
+    if (checked) {
+        lv_btnmatrix_set_btn_ctrl(matrix_, index, LV_BTNMATRIX_CTRL_CHECKED);
+    } else {
+        lv_btnmatrix_clear_btn_ctrl(matrix_, index, LV_BTNMATRIX_CTRL_CHECKED);
+    }
+}
+
+void HdButtonGrid::on_value_changed_(lv_event_t *e) {
+    auto obj = (HdButtonGrid*)lv_event_get_user_data(e);
+    uint16_t index = *(uint32_t*)lv_event_get_param(e);
+    if (index >= obj->buttons_.size())
+        return;
+
+    auto &button = obj->buttons_[index];
+    if (obj->long_pressed_) {
+        // Releasing a long press isn't a click, undo the toggle
+        obj->long_pressed_ = false;
+        obj->set_checked_(index, button.checked);
+        return;
+    }
+
+    button.click_callback.call();
+
+    if (!button.toggle)
+        return;
+
+    if (button.checked) {
+        button.turn_off_callback.call();
+    } else {
+        button.turn_on_callback.call();
+    }
+}
+
+void HdButtonGrid::on_long_press_(lv_event_t *e) {
+    auto obj = (HdButtonGrid*)lv_event_get_user_data(e);
+    uint16_t index = lv_btnmatrix_get_selected_btn(obj->matrix_);
+    if (index >= obj->buttons_.size())
+        return;
+
+    obj->long_pressed_ = true;
+    obj->buttons_[index].long_press_callback.call();
+}
+
+void HdButtonGrid::on_draw_part_end_(lv_event_t *e) {
+    auto obj = (HdButtonGrid*)lv_event_get_user_data(e);
+    auto dsc = lv_event_get_draw_part_dsc(e);
+    if (dsc->class_p != &lv_btnmatrix_class || dsc->type != LV_BTNMATRIX_DRAW_PART_BTN)
+        return;
+    if (dsc->id >= obj->buttons_.size())
+        return;
+
+    auto &button = obj->buttons_[dsc->id];
+    lv_opa_t opa = lv_obj_has_state(obj->matrix_, LV_STATE_DISABLED) ? 150 : LV_OPA_COVER;
+    draw_button_content_(dsc->draw_ctx, dsc->draw_area, button.icon.c_str(), button.text.c_str(), opa);
+}
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+#include "ha_deck_widget.h"
+
+namespace esphome {
+namespace ha_deck {
+
+// N buttons rendered by a single lv_btnmatrix
+class HdButtonGrid : public HaDeckWidget
+{
+public:
+    void set_columns(uint8_t columns);
+    void add_button(std::string text, std::string icon, bool toggle);
+    bool is_checked(uint8_t index);
+
+    void add_checked_lambda(uint8_t index, std::function<optional<bool>()> &&f);
+    void add_on_click_callback(uint8_t index, std::function<void()> &&callback);
+    void add_on_turn_on_callback(uint8_t index, std::function<void()> &&callback);
+    void add_on_turn_off_callback(uint8_t index, std::function<void()> &&callback);
+    void add_on_long_press_callback(uint8_t index, std::function<void()> &&callback);
+protected:
+    void render_();
+    void destroy_();
+    void update_();
+    void set_visible_(bool visible);
+    void set_enabled_(bool enabled);
+private:
+    struct Button {
+        std::string text;
+        std::string icon;
+        bool toggle = false;
+        bool checked = false;
+        std::function<optional<bool>()> checked_fn = nullptr;
+        CallbackManager<void()> click_callback{};
+        CallbackManager<void()> turn_on_callback{};
+        CallbackManager<void()> turn_off_callback{};
+        CallbackManager<void()> long_press_callback{};
+    };
+
+    static void on_value_changed_(lv_event_t *e);
+    static void on_long_press_(lv_event_t *e);
+    static void on_draw_part_end_(lv_event_t *e);
+
+    void set_checked_(uint8_t index, bool checked);
+
+    const char *TAG = "HD_BUTTON_GRID";
+    uint8_t columns_ = 4;
+    bool long_pressed_ = false;
+    std::vector<Button> buttons_ = {};
+    // Button map, has to outlive the matrix
+    std::vector<const char*> map_ = {};
+    lv_obj_t *matrix_ = nullptr;
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,91 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome import automation
+from esphome.const import (
+    CONF_ID,
+    CONF_ICON,
+    CONF_TRIGGER_ID,
+)
+
+from .ha_deck import ha_deck_ns, HaDeckWidget
+
+HdButtonGrid = ha_deck_ns.class_("HdButtonGrid", HaDeckWidget)
+
+ButtonGridClickTrigger = ha_deck_ns.class_(
+    "HdButtonGridClickTrigger", automation.Trigger.template()
+)
+ButtonGridTurnOnTrigger = ha_deck_ns.class_(
+    "HdButtonGridTurnOnTrigger", automation.Trigger.template()
+)
+ButtonGridTurnOffTrigger = ha_deck_ns.class_(
+    "HdButtonGridTurnOffTrigger", automation.Trigger.template()
+)
+ButtonGridLongPressTrigger = ha_deck_ns.class_(
+    "HdButtonGridLongPressTrigger", automation.Trigger.template()
+)
+
+CONF_COLUMNS = "columns"
+CONF_BUTTONS = "buttons"
+CONF_TEXT = "text"
+CONF_TOGGLE = "toggle"
+CONF_CHECKED = "checked"
+CONF_ON_CLICK = "on_click"
+CONF_ON_TURN_ON = "on_turn_on"
+CONF_ON_TURN_OFF = "on_turn_off"
+CONF_ON_LONG_PRESS = "on_long_press"
+
+GRID_BUTTON_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_TEXT, default=""): cv.string,
+        cv.Optional(CONF_ICON, default=""): cv.string,
+        cv.Optional(CONF_TOGGLE, default=False): cv.boolean,
+        cv.Optional(CONF_CHECKED): cv.returning_lambda,
+        cv.Optional(CONF_ON_CLICK): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ButtonGridClickTrigger),
+            }
+        ),
+        cv.Optional(CONF_ON_TURN_ON): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ButtonGridTurnOnTrigger),
+            }
+        ),
+        cv.Optional(CONF_ON_TURN_OFF): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ButtonGridTurnOffTrigger),
+            }
+        ),
+        cv.Optional(CONF_ON_LONG_PRESS): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ButtonGridLongPressTrigger),
+            }
+        ),
+    }
+)
+
+BUTTON_GRID_CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_ID): cv.declare_id(HdButtonGrid),
+        cv.Optional(CONF_COLUMNS, default=4): cv.int_range(min=1, max=16),
+        cv.Required(CONF_BUTTONS): cv.All(
+            cv.ensure_list(GRID_BUTTON_SCHEMA), cv.Length(min=1, max=64)
+        ),
+    }
+)
+
+async def build_button_grid(var, config):
+    cg.add(var.set_columns(config[CONF_COLUMNS]))
+
+    for index, button in enumerate(config[CONF_BUTTONS]):
+        cg.add(var.add_button(button[CONF_TEXT], button[CONF_ICON], button[CONF_TOGGLE]))
+
+        if CONF_CHECKED in button:
+            checked = await cg.process_lambda(
+                    button[CONF_CHECKED], [], return_type=cg.optional.template(bool)
+                )
+            cg.add(var.add_checked_lambda(index, checked))
+
+        for key in (CONF_ON_CLICK, CONF_ON_TURN_ON, CONF_ON_TURN_OFF, CONF_ON_LONG_PRESS):
+            for conf in button.get(key, []):
+                trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var, index)
+                await automation.build_automation(trigger, [], conf)
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "hd_button_grid.h"
+
+namespace esphome {
+namespace ha_deck {
+
+class HdButtonGridClickTrigger : public Trigger<> {
+ public:
+  HdButtonGridClickTrigger(HdButtonGrid *grid, uint8_t index) {
+    grid->add_on_click_callback(index, [this]() { this->trigger(); });
+  }
+};
+
+class HdButtonGridTurnOnTrigger : public Trigger<> {
+ public:
+  HdButtonGridTurnOnTrigger(HdButtonGrid *grid, uint8_t index) {
+    grid->add_on_turn_on_callback(index, [this]() { this->trigger(); });
+  }
+};
+
+class HdButtonGridTurnOffTrigger : public Trigger<> {
+ public:
+  HdButtonGridTurnOffTrigger(HdButtonGrid *grid, uint8_t index) {
+    grid->add_on_turn_off_callback(index, [this]() { this->trigger(); });
+  }
+};
+
+class HdButtonGridLongPressTrigger : public Trigger<> {
+ public:
+  HdButtonGridLongPressTrigger(HdButtonGrid *grid, uint8_t index) {
+    grid->add_on_long_press_callback(index, [this]() { this->trigger(); });
+  }
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
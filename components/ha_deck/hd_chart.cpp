@@ -0,0 +1,241 @@
+#include "hd_chart.h"
+#include "esphome/core/hal.h"
+#include <algorithm>
+#include <cmath>
+#include <esp_heap_caps.h>
+
+namespace esphome {
+namespace ha_deck {
+
+// Empty columns in front of the cursor, separating the newest data from the oldest
+static const uint16_t CURSOR_GAP = 4;
+static const lv_coord_t PADDING = 10;
+
+void HdChart::setup() {
+    lv_area_t coords = {0, 0, (lv_coord_t)((w_ > 0 ? w_ : 228) - 1), (lv_coord_t)((h_ > 0 ? h_ : 96) - 1)};
+    lv_area_t plot;
+    get_plot_area_(&coords, &plot);
+    columns_ = lv_area_get_width(&plot);
+    column_time_ = std::max<uint32_t>(period_ / columns_, 1);
+    head_ = 0;
+    column_at_ = millis();
+
+    uint32_t caps = psram_ ? MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT : MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    for (auto &series : series_) {
+        series.columns = (Column *)heap_caps_malloc(columns_ * sizeof(Column), caps);
+        if (!series.columns) {
+            ESP_LOGE(this->TAG, "Can't allocate %u bytes for chart history", columns_ * sizeof(Column));
+            this->mark_failed();
+            return;
+        }
+        for (uint16_t i = 0; i < columns_; i++)
+            series.columns[i] = {NAN, NAN};
+    }
+    ESP_LOGD(this->TAG, "%u columns of %u ms, %u bytes per series in %s", columns_, column_time_,
+        columns_ * sizeof(Column), psram_ ? "PSRAM" : "internal RAM");
+}
+
+void HdChart::set_text(std::string text) {
+    text_ = text;
+}
+
+void HdChart::set_period(uint32_t period_ms) {
+    period_ = period_ms;
+}
+
+void HdChart::set_range(float min, float max) {
+    auto_range_ = false;
+    min_ = min;
+    max_ = max;
+}
+
+void HdChart::set_psram(bool psram) {
+    psram_ = psram;
+}
+
+void HdChart::add_series(uint32_t color) {
+    Series series;
+    series.color = lv_color_hex(color);
+    series_.push_back(series);
+}
+
+#ifdef USE_SENSOR
+void HdChart::add_sensor(uint8_t series, sensor::Sensor *sensor) {
+    sensor->add_on_state_callback([this, series](float value) { this->add_value(series, value); });
+}
+#endif
+
+void HdChart::add_value(uint8_t series, float value) {
+    if (this->is_failed() || series >= series_.size() || !series_[series].columns || std::isnan(value))
+        return;
+
+    advance_(millis());
+
+    bool below = std::isnan(min_) || value < min_;
+    bool above = std::isnan(max_) || value > max_;
+    if (auto_range_ && (below || above)) {
+        // Only grows, with a margin on the side that was exceeded, so a full redraw stays rare
+        float min = below ? value : min_;
+        float max = above ? value : max_;
+        float margin = std::max((max - min) * 0.1f, 0.5f);
+        if (below)
+            min_ = min - margin;
+        if (above)
+            max_ = max + margin;
+        if (lv_main_)
+            lv_obj_invalidate(lv_main_);
+    }
+
+    auto &column = series_[series].columns[head_ % columns_];
+    if (!std::isnan(column.min) && value >= column.min && value <= column.max)
+        return;
+
+    column.min = std::isnan(column.min) ? value : std::min(column.min, value);
+    column.max = std::isnan(column.max) ? value : std::max(column.max, value);
+    // The next column connects to this one
+    invalidate_columns_(head_, 2);
+}
+
+void HdChart::advance_(uint32_t now) {
+    // Unsigned difference, so millis() wrapping around doesn't stop the cursor
+    uint32_t elapsed = (now - column_at_) / column_time_;
+    if (elapsed == 0)
+        return;
+    column_at_ += elapsed * column_time_;
+
+    uint32_t count = std::min<uint32_t>(elapsed, columns_);
+    for (uint32_t i = 1; i <= count; i++) {
+        for (auto &series : series_)
+            series.columns[(head_ + i) % columns_] = {NAN, NAN};
+    }
+    // The cleared columns plus the gap moving along with the cursor
+    invalidate_columns_(head_, count + CURSOR_GAP + 1);
+    head_ = (head_ + elapsed % columns_) % columns_;
+}
+
+void HdChart::invalidate_columns_(uint32_t from, uint32_t count) {
+    if (!lv_main_)
+        return;
+
+    lv_area_t plot;
+    get_plot_area_(&lv_main_->coords, &plot);
+    if (count >= columns_) {
+        lv_obj_invalidate_area(lv_main_, &plot);
+        return;
+    }
+
+    // The strip may wrap around the right edge
+    uint16_t start = from % columns_;
+    uint16_t end = start + count - 1;
+    lv_area_t strip = plot;
+    strip.x1 = plot.x1 + start;
+    strip.x2 = plot.x1 + std::min<uint16_t>(end, columns_ - 1);
+    lv_obj_invalidate_area(lv_main_, &strip);
+    if (end >= columns_) {
+        strip.x1 = plot.x1;
+        strip.x2 = plot.x1 + end - columns_;
+        lv_obj_invalidate_area(lv_main_, &strip);
+    }
+}
+
+void HdChart::render_() {
+    lv_main_ = create_drawn_obj_(w_ > 0 ? w_ : 228, h_ > 0 ? h_ : 96);
+    lv_obj_clear_flag(lv_main_, LV_OBJ_FLAG_CLICKABLE);
+
+    set_visible(visible_);
+    set_enabled(enabled_);
+}
+
+void HdChart::get_plot_area_(const lv_area_t *coords, lv_area_t *area) {
+    *area = *coords;
+    area->x1 += PADDING;
+    area->x2 -= PADDING;
+    area->y1 += text_.empty() ? PADDING : PADDING + Font16.line_height + 4;
+    area->y2 -= PADDING;
+}
+
+lv_coord_t HdChart::value_to_y_(const lv_area_t *plot, float value) {
+    float range = max_ - min_;
+    float ratio = range > 0 ? (value - min_) / range : 0.5f;
+    ratio = std::max(0.0f, std::min(1.0f, ratio));
+    return plot->y2 - (lv_coord_t)(ratio * (lv_area_get_height(plot) - 1));
+}
+
+void HdChart::draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords) {
+    draw_background_(draw_ctx, coords, lv_color_hex(0x999999), 25);
+    if (!text_.empty()) {
+        lv_area_t text_area = *coords;
+        text_area.y1 += PADDING;
+        draw_text_(draw_ctx, &text_area, text_.c_str(), &Font16, LV_OPA_COVER);
+    }
+    if (std::isnan(min_))
+        return;
+
+    lv_area_t plot;
+    get_plot_area_(coords, &plot);
+    lv_area_t clip;
+    if (!_lv_area_intersect(&clip, &plot, draw_ctx->clip_area))
+        return;
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_opa = LV_OPA_COVER;
+    uint16_t head = head_ % columns_;
+
+    // Only the columns inside the invalidated strip
+    for (lv_coord_t x = clip.x1; x <= clip.x2; x++) {
+        uint16_t i = x - plot.x1;
+        uint16_t age = (head + columns_ - i) % columns_;
+        if (age >= columns_ - CURSOR_GAP)
+            continue;
+
+        for (auto &series : series_) {
+            auto &column = series.columns[i];
+            if (std::isnan(column.min))
+                continue;
+
+            float lo = column.min;
+            float hi = column.max;
+            // Vertical span down to the previous column, so the line stays continuous
+            if (age + 1 < columns_ - CURSOR_GAP) {
+                auto &prev = series.columns[(i + columns_ - 1) % columns_];
+                if (!std::isnan(prev.min)) {
+                    lo = std::min(lo, prev.max);
+                    hi = std::max(hi, prev.min);
+                }
+            }
+            lv_area_t area = {x, value_to_y_(&plot, hi), x, value_to_y_(&plot, lo)};
+            dsc.bg_color = series.color;
+            lv_draw_rect(draw_ctx, &dsc, &area);
+        }
+    }
+}
+
+void HdChart::destroy_() {
+    lv_obj_del(lv_main_);
+    lv_main_ = nullptr;
+}
+
+void HdChart::update_() {
+    // Moves the cursor when no values come in
+    if (columns_ > 0)
+        advance_(millis());
+}
+
+void HdChart::set_visible_(bool visible) {
+    if (!lv_main_)
+        return;
+
+    if (visible) {
+        lv_obj_clear_flag(lv_main_, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(lv_main_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void HdChart::set_enabled_(bool enabled) {
+    // Nothing to interact with
+}
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+#include "esphome/core/defines.h"
+#include "ha_deck_widget.h"
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+namespace esphome {
+namespace ha_deck {
+
+// History of one or more values, one column per pixel, drawn in sweep mode:
+// columns stay in place and a cursor moves over the oldest ones
+class HdChart : public HaDeckWidget
+{
+public:
+    void setup() override;
+
+    void set_text(std::string text);
+    // Time shown across the whole width
+    void set_period(uint32_t period_ms);
+    void set_range(float min, float max);
+    void set_psram(bool psram);
+    void add_series(uint32_t color);
+#ifdef USE_SENSOR
+    void add_sensor(uint8_t series, sensor::Sensor *sensor);
+#endif
+    void add_value(uint8_t series, float value);
+protected:
+    void render_();
+    void destroy_();
+    void update_();
+    void set_visible_(bool visible);
+    void set_enabled_(bool enabled);
+    void draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords);
+private:
+    struct Column {
+        float min;
+        float max;
+    };
+    struct Series {
+        lv_color_t color;
+        // One min/max pair per pixel column, allocated once in setup()
+        Column *columns = nullptr;
+    };
+
+    void get_plot_area_(const lv_area_t *coords, lv_area_t *area);
+    lv_coord_t value_to_y_(const lv_area_t *plot, float value);
+    // Moves the cursor by the columns elapsed since column_at_
+    void advance_(uint32_t now);
+    void invalidate_columns_(uint32_t from, uint32_t count);
+
+    const char *TAG = "HD_CHART";
+    std::string text_;
+    uint32_t period_ = 3600000;
+    bool auto_range_ = true;
+    float min_ = NAN;
+    float max_ = NAN;
+    bool psram_ = false;
+    std::vector<Series> series_ = {};
+    uint16_t columns_ = 0;
+    uint32_t column_time_ = 0;
+    // Column being filled, and the millis() at which it started
+    uint32_t head_ = 0;
+    uint32_t column_at_ = 0;
+    lv_obj_t *lv_main_ = nullptr;
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,69 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_ID,
+    CONF_COLOR,
+    CONF_MIN_VALUE,
+    CONF_MAX_VALUE,
+    CONF_PERIOD,
+    CONF_SENSOR,
+)
+
+from .ha_deck import ha_deck_ns, HaDeckWidget
+
+HdChart = ha_deck_ns.class_("HdChart", HaDeckWidget)
+
+CONF_TEXT = "text"
+CONF_SERIES = "series"
+CONF_MEMORY = "memory"
+
+CHART_MEMORY = {
+    "internal": False,
+    "psram": True,
+}
+
+SERIES_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_SENSOR): cv.use_id(sensor.Sensor),
+        cv.Optional(CONF_COLOR, default=0xFCD663): cv.hex_uint32_t,
+    }
+)
+
+def validate_chart_range(config):
+    if (CONF_MIN_VALUE in config) != (CONF_MAX_VALUE in config):
+        raise cv.Invalid(f"{CONF_MIN_VALUE} and {CONF_MAX_VALUE} have to be set together")
+    if CONF_MIN_VALUE in config and config[CONF_MIN_VALUE] >= config[CONF_MAX_VALUE]:
+        raise cv.Invalid(f"{CONF_MIN_VALUE} has to be less than {CONF_MAX_VALUE}")
+    return config
+
+CHART_CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_ID): cv.declare_id(HdChart),
+        cv.Optional(CONF_TEXT): cv.string,
+        cv.Optional(CONF_PERIOD, default="1h"): cv.All(
+            cv.positive_time_period_milliseconds,
+            cv.Range(min=cv.TimePeriod(seconds=10)),
+        ),
+        # Autoscaled when not set
+        cv.Optional(CONF_MIN_VALUE): cv.float_,
+        cv.Optional(CONF_MAX_VALUE): cv.float_,
+        cv.Optional(CONF_MEMORY, default="internal"): cv.one_of(*CHART_MEMORY, lower=True),
+        cv.Required(CONF_SERIES): cv.All(
+            cv.ensure_list(SERIES_SCHEMA), cv.Length(min=1, max=4)
+        ),
+    }
+)
+
+async def build_chart(var, config):
+    if text := config.get(CONF_TEXT):
+        cg.add(var.set_text(text))
+    cg.add(var.set_period(config[CONF_PERIOD].total_milliseconds))
+    if CONF_MIN_VALUE in config:
+        cg.add(var.set_range(config[CONF_MIN_VALUE], config[CONF_MAX_VALUE]))
+    cg.add(var.set_psram(CHART_MEMORY[config[CONF_MEMORY]]))
+
+    for index, series in enumerate(config[CONF_SERIES]):
+        cg.add(var.add_series(series[CONF_COLOR]))
+        sens = await cg.get_variable(series[CONF_SENSOR])
+        cg.add(var.add_sensor(index, sens))
@@ -0,0 +1,173 @@
+#include "hd_clock.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace esphome {
+namespace ha_deck {
+
+#ifdef USE_TIME
+void HdClock::set_time(time::RealTimeClock *time) {
+    time_ = time;
+}
+#endif
+
+void HdClock::set_format(std::string format) {
+    format_ = format;
+}
+
+void HdClock::set_text(std::string text) {
+    text_ = text;
+}
+
+void HdClock::add_on_click_callback(std::function<void()> &&callback) {
+    this->click_callback_.add(std::move(callback));
+}
+
+void HdClock::render_() {
+    lv_main_ = create_drawn_obj_(w_ > 0 ? w_ : 228, h_ > 0 ? h_ : 96);
+    lv_obj_add_event_cb(lv_main_, HdClock::on_click_, LV_EVENT_SHORT_CLICKED, this);
+
+    // Digits share the widest one's cell, so changing one never moves the others
+    digit_width_ = 0;
+    for (char c = '0'; c <= '9'; c++)
+        digit_width_ = std::max<lv_coord_t>(digit_width_, lv_font_get_glyph_width(&Font24, c, 0));
+
+    set_visible(visible_);
+    set_enabled(enabled_);
+}
+
+void HdClock::update_() {
+#ifdef USE_TIME
+    if (!time_)
+        return;
+
+    auto now = time_->now();
+    if (!now.is_valid() || now.timestamp == timestamp_)
+        return;
+    timestamp_ = now.timestamp;
+
+    char value[sizeof(value_)];
+    if (now.strftime(value, sizeof(value), format_.c_str()) == 0)
+        return;
+    set_value_(value);
+#endif
+}
+
+void HdClock::set_value_(const char *value) {
+    if (strcmp(value, value_) == 0)
+        return;
+
+    char old[sizeof(value_)];
+    strcpy(old, value_);
+    strcpy(value_, value);
+    if (!lv_main_)
+        return;
+
+    lv_area_t row;
+    get_value_area_(&lv_main_->coords, &row);
+    size_t len = strlen(value_);
+    bool digits_only = len == strlen(old);
+    for (size_t i = 0; digits_only && i < len; i++) {
+        if (value_[i] != old[i] && !(isdigit(value_[i]) && isdigit(old[i])))
+            digits_only = false;
+    }
+    // Any other change may move the cells
+    if (!digits_only) {
+        lv_obj_invalidate_area(lv_main_, &row);
+        return;
+    }
+
+    lv_area_t cell = row;
+    cell.x1 = get_cells_x_(&row);
+    for (size_t i = 0; i < len; i++) {
+        cell.x2 = cell.x1 + get_cell_width_(value_[i]) - 1;
+        if (value_[i] != old[i])
+            lv_obj_invalidate_area(lv_main_, &cell);
+        cell.x1 = cell.x2 + 1;
+    }
+}
+
+lv_coord_t HdClock::get_cell_width_(char c) {
+    return isdigit(c) ? digit_width_ : lv_font_get_glyph_width(&Font24, c, 0);
+}
+
+lv_coord_t HdClock::get_cells_x_(const lv_area_t *row) {
+    lv_coord_t width = 0;
+    for (const char *c = value_; *c; c++)
+        width += get_cell_width_(*c);
+    return (row->x1 + row->x2 + 1 - width) / 2;
+}
+
+void HdClock::get_value_area_(const lv_area_t *coords, lv_area_t *area) {
+    // Same layout as a value card: 10px padding, 64px value row
+    *area = *coords;
+    area->y1 += 10;
+    area->y2 = area->y1 + 63;
+}
+
+void HdClock::draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords) {
+    draw_background_(draw_ctx, coords, lv_color_hex(0x999999), 25);
+
+    lv_area_t row;
+    get_value_area_(coords, &row);
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.color = lv_color_hex(0xFFFFFF);
+    dsc.font = &Font24;
+
+    // Characters centered in their cells, on the bottom line of the row
+    lv_point_t pos;
+    pos.y = row.y2 - Font24.line_height + 1;
+    lv_coord_t x = get_cells_x_(&row);
+    for (const char *c = value_; *c; c++) {
+        lv_coord_t width = get_cell_width_(*c);
+        pos.x = x + (width - lv_font_get_glyph_width(&Font24, *c, 0)) / 2;
+        // Skips the cells outside of the invalidated area
+        if (x + width > draw_ctx->clip_area->x1 && x <= draw_ctx->clip_area->x2)
+            lv_draw_letter(draw_ctx, &dsc, &pos, *c);
+        x += width;
+    }
+
+    if (!text_.empty()) {
+        lv_area_t area = *coords;
+        area.y2 -= 13;
+        area.y1 = area.y2 - Font16.line_height + 1;
+        draw_text_(draw_ctx, &area, text_.c_str(), &Font16, LV_OPA_COVER);
+    }
+}
+
+void HdClock::destroy_() {
+    lv_obj_del(lv_main_);
+    lv_main_ = nullptr;
+}
+
+void HdClock::set_visible_(bool visible) {
+    if (!lv_main_)
+        return;
+
+    if (visible) {
+        lv_obj_clear_flag(lv_main_, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(lv_main_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void HdClock::set_enabled_(bool enabled) {
+    if (!lv_main_)
+        return;
+
+    if (enabled) {
+        lv_obj_clear_state(lv_main_, LV_STATE_DISABLED);
+    } else {
+        lv_obj_add_state(lv_main_, LV_STATE_DISABLED);
+    }
+}
+
+void HdClock::on_click_(lv_event_t *e) {
+    auto obj = (HdClock*)lv_event_get_user_data(e);
+    obj->click_callback_.call();
+}
+
+}  // namespace ha_deck
+}  // namespace esphome
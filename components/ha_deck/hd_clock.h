@@ -0,0 +1,55 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#include "ha_deck_widget.h"
+
+#ifdef USE_TIME
+#include "esphome/components/time/real_time_clock.h"
+#endif
+
+namespace esphome {
+namespace ha_deck {
+
+// Time from a clock component, every character has its own cell so a tick redraws only the changed digits
+class HdClock : public HaDeckWidget
+{
+public:
+#ifdef USE_TIME
+    void set_time(time::RealTimeClock *time);
+#endif
+    void set_format(std::string format);
+    void set_text(std::string text);
+
+    void add_on_click_callback(std::function<void()> &&callback);
+protected:
+    void render_();
+    void destroy_();
+    void update_();
+    void set_visible_(bool visible);
+    void set_enabled_(bool enabled);
+    void draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords);
+private:
+    static void on_click_(lv_event_t *e);
+    void set_value_(const char *value);
+    void get_value_area_(const lv_area_t *coords, lv_area_t *area);
+    lv_coord_t get_cell_width_(char c);
+    // Left edge of the first cell, the cells are centered as a group
+    lv_coord_t get_cells_x_(const lv_area_t *row);
+
+    const char *TAG = "HD_CLOCK";
+#ifdef USE_TIME
+    time::RealTimeClock *time_ = nullptr;
+#endif
+    std::string format_ = "%H:%M";
+    std::string text_;
+    time_t timestamp_ = 0;
+    char value_[32] = "-";
+    lv_coord_t digit_width_ = 0;
+
+    lv_obj_t *lv_main_ = nullptr;
+
+    CallbackManager<void()> click_callback_{};
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,48 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome import automation
+from esphome.components import time
+from esphome.const import (
+    CONF_ID,
+    CONF_FORMAT,
+    CONF_TIME_ID,
+    CONF_TRIGGER_ID,
+)
+
+from .ha_deck import ha_deck_ns, HaDeckWidget
+
+HdClock = ha_deck_ns.class_("HdClock", HaDeckWidget)
+
+ClockClickTrigger = ha_deck_ns.class_(
+    "HdClockClickTrigger", automation.Trigger.template()
+)
+
+CONF_TEXT = "text"
+CONF_ON_CLICK = "on_click"
+
+CLOCK_CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_ID): cv.declare_id(HdClock),
+        cv.Required(CONF_TIME_ID): cv.use_id(time.RealTimeClock),
+        # strftime format, up to 31 characters of output
+        cv.Optional(CONF_FORMAT, default="%H:%M"): cv.string,
+        cv.Optional(CONF_TEXT): cv.string,
+        cv.Optional(CONF_ON_CLICK): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ClockClickTrigger),
+            }
+        ),
+    }
+)
+
+async def build_clock(var, config):
+    rtc = await cg.get_variable(config[CONF_TIME_ID])
+    cg.add(var.set_time(rtc))
+    cg.add(var.set_format(config[CONF_FORMAT]))
+
+    if text := config.get(CONF_TEXT):
+        cg.add(var.set_text(text))
+
+    for conf in config.get(CONF_ON_CLICK, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(trigger, [], conf)
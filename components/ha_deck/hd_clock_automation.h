@@ -0,0 +1,18 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "hd_clock.h"
+
+namespace esphome {
+namespace ha_deck {
+
+class HdClockClickTrigger : public Trigger<> {
+ public:
+  HdClockClickTrigger(HdClock *clock) {
+    clock->add_on_click_callback([this]() { this->trigger(); });
+  }
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,262 @@
+#include "hd_image.h"
+#include "esphome/core/hal.h"
+#include <algorithm>
+#include <esp_heap_caps.h>
+#include <esp_http_client.h>
+#include <esp_partition.h>
+
+#define LGFX_USE_V1
+#include <LovyanGFX.h>
+
+namespace esphome {
+namespace ha_deck {
+
+// Failed images are tried again while shown, e.g. when the network wasn't up yet
+static const uint32_t RETRY_INTERVAL = 10000;
+
+// Feeds the encoded image to LovyanGFX's decoders in small reads,
+// the whole file is never held in memory
+class ImageReader : public lgfx::DataWrapper
+{
+public:
+    // Reads the signature, it is replayed to the decoder
+    bool begin() {
+        head_len_ = std::max(read_raw_(head_, sizeof(head_)), 0);
+        return head_len_ == sizeof(head_);
+    }
+    bool is_png() { return head_[0] == 0x89 && head_[1] == 'P'; }
+    bool is_jpeg() { return head_[0] == 0xFF && head_[1] == 0xD8; }
+
+    int read(uint8_t *buf, uint32_t len) override {
+        uint32_t n = 0;
+        while (head_pos_ < head_len_ && n < len)
+            buf[n++] = head_[head_pos_++];
+        if (n < len) {
+            int r = read_raw_(buf + n, len - n);
+            if (r > 0)
+                n += r;
+        }
+        pos_ += n;
+        return n;
+    }
+    void skip(int32_t offset) override {
+        uint8_t buf[64];
+        while (offset > 0) {
+            int n = read(buf, std::min<int32_t>(offset, sizeof(buf)));
+            if (n <= 0)
+                break;
+            offset -= n;
+        }
+    }
+    // Forward only, the sources are streams
+    bool seek(uint32_t offset) override {
+        if (offset < pos_)
+            return false;
+        skip(offset - pos_);
+        return pos_ == offset;
+    }
+    int32_t tell() override { return pos_; }
+    void close() override {}
+protected:
+    virtual int read_raw_(uint8_t *buf, uint32_t len) = 0;
+private:
+    uint8_t head_[2] = {0, 0};
+    int head_len_ = 0;
+    int head_pos_ = 0;
+    uint32_t pos_ = 0;
+};
+
+class PartitionReader : public ImageReader
+{
+public:
+    bool open(const std::string &name, uint32_t offset) {
+        partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name.c_str());
+        offset_ = offset;
+        return partition_ && offset < partition_->size;
+    }
+protected:
+    int read_raw_(uint8_t *buf, uint32_t len) override {
+        len = std::min<uint32_t>(len, partition_->size - offset_);
+        if (len == 0 || esp_partition_read(partition_, offset_, buf, len) != ESP_OK)
+            return 0;
+        offset_ += len;
+        return len;
+    }
+private:
+    const esp_partition_t *partition_ = nullptr;
+    uint32_t offset_ = 0;
+};
+
+class HttpReader : public ImageReader
+{
+public:
+    ~HttpReader() {
+        if (client_)
+            esp_http_client_cleanup(client_);
+    }
+    bool open(const std::string &url) {
+        esp_http_client_config_t config = {};
+        config.url = url.c_str();
+        config.timeout_ms = 5000;
+        client_ = esp_http_client_init(&config);
+        if (!client_ || esp_http_client_open(client_, 0) != ESP_OK)
+            return false;
+        esp_http_client_fetch_headers(client_);
+        return esp_http_client_get_status_code(client_) == 200;
+    }
+protected:
+    int read_raw_(uint8_t *buf, uint32_t len) override {
+        uint32_t n = 0;
+        while (n < len) {
+            int r = esp_http_client_read(client_, (char *)buf + n, len - n);
+            if (r <= 0)
+                break;
+            n += r;
+        }
+        return n;
+    }
+private:
+    esp_http_client_handle_t client_ = nullptr;
+};
+
+void HdImage::set_url(std::string url) {
+    url_ = url;
+}
+
+void HdImage::set_asset(std::string partition, uint32_t offset) {
+    partition_ = partition;
+    offset_ = offset;
+}
+
+void HdImage::render_() {
+    lv_img_ = lv_img_create(parent_);
+    lv_obj_set_pos(lv_img_, x_, y_);
+    lv_obj_set_size(lv_img_, w_, h_);
+
+    // The same source shown at another size is another image
+    if (key_.empty()) {
+        key_ = (url_.empty() ? partition_ + "@" + to_string(offset_) : url_) + "/" + to_string(w_) + "x"
+            + to_string(h_);
+    }
+
+    if (auto entry = HdImageCache::acquire(key_)) {
+        show_(entry);
+    } else if (decode_state_ == DECODE_IDLE) {
+        start_decode_();
+    }
+
+    set_visible(visible_);
+    set_enabled(enabled_);
+}
+
+void HdImage::show_(HdImageCache::Entry *entry) {
+    entry_ = entry;
+    lv_img_set_src(lv_img_, &entry_->dsc);
+}
+
+void HdImage::destroy_() {
+    lv_obj_del(lv_img_);
+    lv_img_ = nullptr;
+    if (entry_) {
+        HdImageCache::release(entry_);
+        entry_ = nullptr;
+    }
+}
+
+void HdImage::update_() {
+    if (decode_state_ == DECODE_DONE) {
+        // Cached even if the screen is gone by now
+        auto entry = HdImageCache::insert(key_, decoded_, w_, h_);
+        decoded_ = nullptr;
+        decode_state_ = DECODE_IDLE;
+        if (profile_) {
+            ESP_LOGI(this->TAG, "%s decoded in %u ms, cache %u bytes", key_.c_str(), decode_time_,
+                HdImageCache::get_size());
+        }
+        if (lv_img_ && !entry_) {
+            show_(entry);
+        } else {
+            HdImageCache::release(entry);
+        }
+    } else if (decode_state_ == DECODE_FAILED) {
+        decode_state_ = DECODE_IDLE;
+    } else if (decode_state_ == DECODE_IDLE && lv_img_ && !entry_ && millis() - last_attempt_ > RETRY_INTERVAL) {
+        start_decode_();
+    }
+}
+
+void HdImage::start_decode_() {
+    last_attempt_ = millis();
+    decode_state_ = DECODE_RUNNING;
+    // Network reads and decoding take a while, keep them off the UI core
+    if (xTaskCreatePinnedToCore(HdImage::decode_task_, "hd_image", 8192, this, 1, nullptr, 0) != pdPASS)
+        decode_state_ = DECODE_FAILED;
+}
+
+void HdImage::decode_task_(void *param) {
+    auto image = (HdImage *) param;
+    uint32_t start = millis();
+    image->decoded_ = image->decode_();
+    image->decode_time_ = millis() - start;
+    image->decode_state_ = image->decoded_ ? DECODE_DONE : DECODE_FAILED;
+    vTaskDelete(nullptr);
+}
+
+void *HdImage::decode_() {
+    PartitionReader partition_reader;
+    HttpReader http_reader;
+    ImageReader *reader = &partition_reader;
+    bool opened;
+    if (url_.empty()) {
+        opened = partition_reader.open(partition_, offset_);
+    } else {
+        opened = http_reader.open(url_);
+        reader = &http_reader;
+    }
+    if (!opened || !reader->begin()) {
+        ESP_LOGW(this->TAG, "Can't read %s", key_.c_str());
+        return nullptr;
+    }
+    if (!reader->is_png() && !reader->is_jpeg()) {
+        ESP_LOGW(this->TAG, "%s isn't a PNG or JPEG", key_.c_str());
+        return nullptr;
+    }
+
+    uint32_t size = w_ * h_ * sizeof(lv_color_t);
+    void *pixels = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!pixels) {
+        ESP_LOGW(this->TAG, "Can't allocate %u bytes for %s", size, key_.c_str());
+        return nullptr;
+    }
+
+    // The sprite only wraps the cache buffer, its byte swapped RGB565 matches LV_COLOR_16_SWAP
+    LGFX_Sprite sprite;
+    sprite.setColorDepth(16);
+    sprite.setBuffer(pixels, w_, h_, 16);
+    sprite.fillScreen(0);
+    bool ok = reader->is_png() ? sprite.drawPng(reader, 0, 0) : sprite.drawJpg(reader, 0, 0);
+    if (!ok) {
+        ESP_LOGW(this->TAG, "Can't decode %s", key_.c_str());
+        heap_caps_free(pixels);
+        return nullptr;
+    }
+    return pixels;
+}
+
+void HdImage::set_visible_(bool visible) {
+    if (!lv_img_)
+        return;
+
+    if (visible) {
+        lv_obj_clear_flag(lv_img_, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(lv_img_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void HdImage::set_enabled_(bool enabled) {
+    // Nothing to interact with
+}
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "ha_deck_widget.h"
+#include "hd_image_cache.h"
+
+namespace esphome {
+namespace ha_deck {
+
+// PNG or JPEG from an HTTP URL or a data partition, decoded in a background task
+// straight into a cache buffer of the widget's size
+class HdImage : public HaDeckWidget
+{
+public:
+    void set_url(std::string url);
+    void set_asset(std::string partition, uint32_t offset);
+protected:
+    void render_();
+    void destroy_();
+    void update_();
+    void set_visible_(bool visible);
+    void set_enabled_(bool enabled);
+private:
+    enum DecodeState : uint8_t {
+        DECODE_IDLE = 0,
+        DECODE_RUNNING,
+        DECODE_DONE,
+        DECODE_FAILED,
+    };
+
+    static void decode_task_(void *param);
+    void *decode_();
+    void start_decode_();
+    void show_(HdImageCache::Entry *entry);
+
+    const char *TAG = "HD_IMAGE";
+    std::string url_;
+    std::string partition_;
+    uint32_t offset_ = 0;
+    std::string key_;
+
+    volatile DecodeState decode_state_ = DECODE_IDLE;
+    void *decoded_ = nullptr;
+    uint32_t decode_time_ = 0;
+    uint32_t last_attempt_ = 0;
+    HdImageCache::Entry *entry_ = nullptr;
+    lv_obj_t *lv_img_ = nullptr;
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
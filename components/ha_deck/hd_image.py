@@ -0,0 +1,45 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_ID,
+    CONF_URL,
+    CONF_DIMENSIONS,
+    CONF_OFFSET,
+)
+
+from .ha_deck import ha_deck_ns, HaDeckWidget
+
+HdImage = ha_deck_ns.class_("HdImage", HaDeckWidget)
+
+CONF_ASSET = "asset"
+CONF_PARTITION = "partition"
+
+ASSET_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_PARTITION, default="assets"): cv.string,
+        cv.Required(CONF_OFFSET): cv.hex_uint32_t,
+    }
+)
+
+def validate_image(config):
+    # The decoded image is cached at this size
+    if CONF_DIMENSIONS not in config:
+        raise cv.Invalid(f"{CONF_DIMENSIONS} are required for images")
+    if (CONF_URL in config) == (CONF_ASSET in config):
+        raise cv.Invalid(f"Exactly one of {CONF_URL} or {CONF_ASSET} has to be set")
+    return config
+
+IMAGE_CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_ID): cv.declare_id(HdImage),
+        cv.Optional(CONF_URL): cv.url,
+        cv.Optional(CONF_ASSET): ASSET_SCHEMA,
+    }
+)
+
+async def build_image(var, config):
+    if url := config.get(CONF_URL):
+        cg.add(var.set_url(url))
+
+    if asset := config.get(CONF_ASSET):
+        cg.add(var.set_asset(asset[CONF_PARTITION], asset[CONF_OFFSET]))
@@ -0,0 +1,78 @@
+#include "hd_image_cache.h"
+#include "esphome/core/log.h"
+#include <esp_heap_caps.h>
+
+namespace esphome {
+namespace ha_deck {
+
+static const char *const TAG = "HD_IMAGE_CACHE";
+
+std::list<HdImageCache::Entry> HdImageCache::entries_;
+uint32_t HdImageCache::capacity_ = 524288;
+uint32_t HdImageCache::size_ = 0;
+
+void HdImageCache::set_capacity(uint32_t bytes) {
+    capacity_ = bytes;
+}
+
+HdImageCache::Entry *HdImageCache::acquire(const std::string &key) {
+    for (auto it = entries_.begin(); it != entries_.end(); it++) {
+        if (it->key != key)
+            continue;
+        entries_.splice(entries_.begin(), entries_, it);
+        auto &entry = entries_.front();
+        entry.refs++;
+        return &entry;
+    }
+    return nullptr;
+}
+
+HdImageCache::Entry *HdImageCache::insert(const std::string &key, void *pixels, uint16_t w, uint16_t h) {
+    // Decoded twice by widgets showing the same image at once
+    if (auto entry = acquire(key)) {
+        heap_caps_free(pixels);
+        return entry;
+    }
+
+    entries_.emplace_front();
+    auto &entry = entries_.front();
+    entry.key = key;
+    entry.refs = 1;
+    entry.dsc.header.always_zero = 0;
+    entry.dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    entry.dsc.header.w = w;
+    entry.dsc.header.h = h;
+    entry.dsc.data_size = w * h * sizeof(lv_color_t);
+    entry.dsc.data = (const uint8_t *)pixels;
+    size_ += entry.dsc.data_size;
+
+    evict_();
+    ESP_LOGD(TAG, "Cached %s, %u of %u bytes used", key.c_str(), size_, capacity_);
+    return &entry;
+}
+
+void HdImageCache::release(Entry *entry) {
+    if (entry && entry->refs > 0)
+        entry->refs--;
+    evict_();
+}
+
+void HdImageCache::evict_() {
+    // Images on screen stay even if the cache is over capacity
+    for (auto it = entries_.end(); size_ > capacity_ && it != entries_.begin();) {
+        it--;
+        if (it->refs > 0)
+            continue;
+        ESP_LOGD(TAG, "Evicting %s", it->key.c_str());
+        size_ -= it->dsc.data_size;
+        heap_caps_free((void *)it->dsc.data);
+        it = entries_.erase(it);
+    }
+}
+
+uint32_t HdImageCache::get_size() {
+    return size_;
+}
+
+}  // namespace ha_deck
+}  // namespace esphome
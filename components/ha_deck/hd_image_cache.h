@@ -0,0 +1,39 @@
+#pragma once
+
+#include <list>
+#include <string>
+#include "lvgl.h"
+
+namespace esphome {
+namespace ha_deck {
+
+// Decoded images shared by all image widgets, kept in PSRAM and evicted least recently used first.
+// Used from the main loop only.
+class HdImageCache
+{
+public:
+    struct Entry {
+        std::string key;
+        lv_img_dsc_t dsc;
+        // Widgets showing the image, it isn't evicted while > 0
+        uint32_t refs = 0;
+    };
+
+    static void set_capacity(uint32_t bytes);
+    // Returns the image with a reference taken, nullptr if it isn't cached
+    static Entry *acquire(const std::string &key);
+    // Takes over pixels (allocated with heap_caps_malloc), returns the entry with a reference taken
+    static Entry *insert(const std::string &key, void *pixels, uint16_t w, uint16_t h);
+    static void release(Entry *entry);
+    static uint32_t get_size();
+private:
+    static void evict_();
+
+    // Most recently used first
+    static std::list<Entry> entries_;
+    static uint32_t capacity_;
+    static uint32_t size_;
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
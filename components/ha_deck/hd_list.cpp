@@ -0,0 +1,193 @@
+#include "hd_list.h"
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace ha_deck {
+
+// Space between rows
+static const int16_t ROW_GAP = 8;
+
+void HdList::set_row_height(int16_t height) {
+    row_height_ = height;
+}
+
+void HdList::set_overscan(uint8_t rows) {
+    overscan_ = rows;
+}
+
+void HdList::add_count_lambda(std::function<int()> &&f) {
+    this->count_fn_ = f;
+}
+
+void HdList::add_item_lambda(std::function<std::string(int)> &&f) {
+    this->item_fn_ = f;
+}
+
+void HdList::add_on_click_callback(std::function<void(int)> &&callback) {
+    this->click_callback_.add(std::move(callback));
+}
+
+void HdList::render_() {
+    lv_main_ = lv_obj_create(parent_);
+    lv_obj_remove_style_all(lv_main_);
+    lv_obj_set_pos(lv_main_, x_, y_);
+    // Layout hasn't run yet, so the height is taken from the config rather than the object
+    lv_coord_t height = h_ > 0 ? h_ : 304;
+    lv_obj_set_size(lv_main_, w_ > 0 ? w_ : 228, height);
+    lv_obj_set_scroll_dir(lv_main_, LV_DIR_VER);
+    lv_obj_set_scrollbar_mode(lv_main_, LV_SCROLLBAR_MODE_ACTIVE);
+    lv_obj_add_event_cb(lv_main_, HdList::on_scroll_, LV_EVENT_SCROLL, this);
+    // The content height comes from the item count, not from the few row objects
+    lv_obj_add_event_cb(lv_main_, HdList::on_get_self_size_, LV_EVENT_GET_SELF_SIZE, this);
+
+    if (count_fn_)
+        count_ = std::max(count_fn_(), 0);
+
+    // Enough rows to cover the viewport at any scroll position, plus the overscan on both sides
+    int16_t pitch = row_height_ + ROW_GAP;
+    size_t pool = (height + pitch - 1) / pitch + 1 + 2 * overscan_;
+    rows_.clear();
+    row_items_.clear();
+    for (size_t i = 0; i < pool; i++) {
+        rows_.push_back(create_row_());
+        row_items_.push_back(-1);
+    }
+    lv_obj_refresh_self_size(lv_main_);
+    bind_rows_(true);
+
+    set_visible(visible_);
+    set_enabled(enabled_);
+}
+
+lv_obj_t *HdList::create_row_() {
+    auto row = lv_label_create(lv_main_);
+    lv_obj_add_flag(row, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_HIDDEN);
+    lv_obj_set_size(row, lv_pct(100), row_height_);
+    lv_label_set_long_mode(row, LV_LABEL_LONG_DOT);
+    lv_obj_add_event_cb(row, HdList::on_row_click_, LV_EVENT_SHORT_CLICKED, this);
+
+    lv_obj_set_style_radius(row, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_color(row, lv_color_hex(0x999999), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(row, 25, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(row, 60, LV_PART_MAIN | LV_STATE_PRESSED);
+    lv_obj_set_style_bg_opa(row, 5, LV_PART_MAIN | LV_STATE_DISABLED);
+    lv_obj_set_style_text_font(row, &Font16, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_opa(row, 150, LV_PART_MAIN | LV_STATE_DISABLED);
+    lv_obj_set_style_pad_left(row, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_right(row, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_top(row, (row_height_ - Font16.line_height) / 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+    return row;
+}
+
+void HdList::bind_rows_(bool force) {
+    if (!lv_main_ || rows_.empty())
+        return;
+
+    int16_t pitch = row_height_ + ROW_GAP;
+    int first = std::max(lv_obj_get_scroll_y(lv_main_) / pitch - overscan_, 0);
+    int size = rows_.size();
+    for (int index = first; index < first + size; index++) {
+        int slot = index % size;
+        if (!force && row_items_[slot] == index)
+            continue;
+
+        auto row = rows_[slot];
+        row_items_[slot] = index;
+        if (index >= count_) {
+            lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+            continue;
+        }
+        lv_obj_set_y(row, index * pitch);
+        set_row_text_(row, index);
+        lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void HdList::set_row_text_(lv_obj_t *row, int index) {
+    if (!item_fn_)
+        return;
+    auto text = item_fn_(index);
+    // Setting the same text would still relayout and redraw the row
+    if (strcmp(lv_label_get_text(row), text.c_str()) != 0)
+        lv_label_set_text(row, text.c_str());
+}
+
+void HdList::destroy_() {
+    lv_obj_del(lv_main_);
+    lv_main_ = nullptr;
+    rows_.clear();
+    row_items_.clear();
+}
+
+void HdList::update_() {
+    if (!lv_main_)
+        return;
+
+    if (count_fn_) {
+        int count = std::max(count_fn_(), 0);
+        if (count != count_) {
+            count_ = count;
+            lv_obj_refresh_self_size(lv_main_);
+            bind_rows_(true);
+            return;
+        }
+    }
+
+    // Items may change too, only the bound rows are asked
+    for (size_t slot = 0; slot < rows_.size(); slot++) {
+        if (row_items_[slot] >= 0 && row_items_[slot] < count_)
+            set_row_text_(rows_[slot], row_items_[slot]);
+    }
+}
+
+void HdList::set_visible_(bool visible) {
+    if (!lv_main_)
+        return;
+
+    if (visible) {
+        lv_obj_clear_flag(lv_main_, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(lv_main_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void HdList::set_enabled_(bool enabled) {
+    if (!lv_main_)
+        return;
+
+    // Rows don't inherit the state
+    for (auto row : rows_) {
+        if (enabled) {
+            lv_obj_clear_state(row, LV_STATE_DISABLED);
+        } else {
+            lv_obj_add_state(row, LV_STATE_DISABLED);
+        }
+    }
+}
+
+void HdList::on_scroll_(lv_event_t *e) {
+    auto obj = (HdList*)lv_event_get_user_data(e);
+    obj->bind_rows_(false);
+}
+
+void HdList::on_get_self_size_(lv_event_t *e) {
+    auto obj = (HdList*)lv_event_get_user_data(e);
+    auto size = (lv_point_t*)lv_event_get_param(e);
+    lv_coord_t height = obj->count_ > 0 ? obj->count_ * (obj->row_height_ + ROW_GAP) - ROW_GAP : 0;
+    size->y = LV_MAX(size->y, height);
+}
+
+void HdList::on_row_click_(lv_event_t *e) {
+    auto obj = (HdList*)lv_event_get_user_data(e);
+    auto row = lv_event_get_target(e);
+    for (size_t slot = 0; slot < obj->rows_.size(); slot++) {
+        if (obj->rows_[slot] == row) {
+            obj->click_callback_.call(obj->row_items_[slot]);
+            return;
+        }
+    }
+}
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+#include "ha_deck_widget.h"
+
+namespace esphome {
+namespace ha_deck {
+
+// Scrollable list with LVGL objects only for the visible rows, which are reused while scrolling
+class HdList : public HaDeckWidget
+{
+public:
+    void set_row_height(int16_t height);
+    void set_overscan(uint8_t rows);
+
+    void add_count_lambda(std::function<int()> &&f);
+    void add_item_lambda(std::function<std::string(int)> &&f);
+    void add_on_click_callback(std::function<void(int)> &&callback);
+protected:
+    void render_();
+    void destroy_();
+    void update_();
+    void set_visible_(bool visible);
+    void set_enabled_(bool enabled);
+private:
+    static void on_scroll_(lv_event_t *e);
+    static void on_get_self_size_(lv_event_t *e);
+    static void on_row_click_(lv_event_t *e);
+
+    lv_obj_t *create_row_();
+    // Assigns the rows to the items around the scroll position
+    void bind_rows_(bool force);
+    void set_row_text_(lv_obj_t *row, int index);
+
+    const char *TAG = "HD_LIST";
+    int16_t row_height_ = 56;
+    uint8_t overscan_ = 2;
+    int count_ = 0;
+
+    lv_obj_t *lv_main_ = nullptr;
+    // Item index i is shown by rows_[i % rows_.size()]
+    std::vector<lv_obj_t*> rows_ = {};
+    std::vector<int> row_items_ = {};
+
+    std::function<int()> count_fn_ = nullptr;
+    std::function<std::string(int)> item_fn_ = nullptr;
+    CallbackManager<void(int)> click_callback_{};
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,53 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome import automation
+from esphome.const import (
+    CONF_ID,
+    CONF_TRIGGER_ID,
+)
+
+from .ha_deck import ha_deck_ns, HaDeckWidget
+
+HdList = ha_deck_ns.class_("HdList", HaDeckWidget)
+
+ListClickTrigger = ha_deck_ns.class_(
+    "HdListClickTrigger", automation.Trigger.template(cg.int_)
+)
+
+CONF_COUNT = "count"
+CONF_ITEM = "item"
+CONF_ROW_HEIGHT = "row_height"
+CONF_OVERSCAN = "overscan"
+CONF_ON_CLICK = "on_click"
+
+LIST_CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_ID): cv.declare_id(HdList),
+        cv.Required(CONF_COUNT): cv.returning_lambda,
+        # Called with the item's index
+        cv.Required(CONF_ITEM): cv.returning_lambda,
+        cv.Optional(CONF_ROW_HEIGHT, default=56): cv.int_range(min=16, max=320),
+        cv.Optional(CONF_OVERSCAN, default=2): cv.int_range(min=0, max=10),
+        cv.Optional(CONF_ON_CLICK): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ListClickTrigger),
+            }
+        ),
+    }
+)
+
+async def build_list(var, config):
+    cg.add(var.set_row_height(config[CONF_ROW_HEIGHT]))
+    cg.add(var.set_overscan(config[CONF_OVERSCAN]))
+
+    count = await cg.process_lambda(config[CONF_COUNT], [], return_type=cg.int_)
+    cg.add(var.add_count_lambda(count))
+
+    item = await cg.process_lambda(
+            config[CONF_ITEM], [(cg.int_, "index")], return_type=cg.std_string
+        )
+    cg.add(var.add_item_lambda(item))
+
+    for conf in config.get(CONF_ON_CLICK, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(trigger, [(int, "index")], conf)
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "hd_list.h"
+
+namespace esphome {
+namespace ha_deck {
+
+class HdListClickTrigger : public Trigger<int> {
+ public:
+  HdListClickTrigger(HdList *list) {
+    list->add_on_click_callback([this](int index) { this->trigger(index); });
+  }
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
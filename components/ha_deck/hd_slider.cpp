@@ -1,4 +1,5 @@
 #include "hd_slider.h"
+#include <algorithm>
 
 namespace esphome {
 namespace ha_deck {
@@ -25,7 +26,14 @@ void HdSlider::set_value(int value) {
     ESP_LOGD(this->TAG, "set_value: %d", value);
     if (!slider_panel_)
         return;
-    
+
+    if (drawn_) {
+        // Only the track changes
+        lv_area_t area;
+        get_track_area_(&slider_panel_->coords, &area);
+        lv_obj_invalidate_area(slider_panel_, &area);
+        return;
+    }
     lv_slider_set_value(slider_, value_, LV_ANIM_OFF);
 }
 
@@ -34,7 +42,12 @@ int HdSlider::get_value() {
 }
 
 void HdSlider::render_() {
-    slider_panel_ = lv_obj_create(lv_scr_act());
+    if (drawn_) {
+        render_drawn_();
+        return;
+    }
+
+    slider_panel_ = lv_obj_create(parent_);
     lv_obj_set_width(slider_panel_, w_ > 0 ? w_ : 64);
     lv_obj_set_height(slider_panel_, h_ > 0 ? h_ : 304);
     lv_obj_set_x(slider_panel_, x_);
@@ -96,12 +109,83 @@ void HdSlider::render_() {
     }
 }
 
+void HdSlider::render_drawn_() {
+    slider_panel_ = create_drawn_obj_(w_ > 0 ? w_ : 64, h_ > 0 ? h_ : 304);
+    // Vertical drags move the value instead of scrolling the screen
+    lv_obj_clear_flag(slider_panel_, LV_OBJ_FLAG_SCROLL_CHAIN);
+    lv_obj_add_event_cb(slider_panel_, HdSlider::on_drawn_press_, LV_EVENT_PRESSED, this);
+    lv_obj_add_event_cb(slider_panel_, HdSlider::on_drawn_press_, LV_EVENT_PRESSING, this);
+    lv_obj_add_event_cb(slider_panel_, HdSlider::on_value_change_, LV_EVENT_RELEASED, this);
+
+    if (enabled_) {
+        lv_obj_clear_state(slider_panel_, LV_STATE_DISABLED);
+    } else {
+        lv_obj_add_state(slider_panel_, LV_STATE_DISABLED);
+    }
+}
+
+void HdSlider::get_track_area_(const lv_area_t *coords, lv_area_t *area) {
+    // Same layout as the object tree: the track on top, a 28px label row below
+    *area = *coords;
+    area->y2 = coords->y2 - 28;
+}
+
+void HdSlider::draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords) {
+    bool disabled = lv_obj_has_state(slider_panel_, LV_STATE_DISABLED);
+    lv_area_t track;
+    get_track_area_(coords, &track);
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_hex(0xFFE082);
+    dsc.bg_opa = 25;
+    lv_draw_rect(draw_ctx, &dsc, &track);
+
+    // The indicator grows from the bottom of the track
+    int value = std::max(min_, std::min(max_, value_));
+    lv_coord_t track_h = lv_area_get_height(&track);
+    lv_area_t indicator = track;
+    indicator.y1 = track.y2 + 1 - (max_ > min_ ? track_h * (value - min_) / (max_ - min_) : 0);
+    if (indicator.y1 <= indicator.y2) {
+        dsc.bg_opa = disabled ? 100 : 200;
+        lv_draw_rect(draw_ctx, &dsc, &indicator);
+    }
+
+    lv_area_t area = *coords;
+    if (!text_.empty()) {
+        area.y1 = coords->y2 - Font16.line_height + 1;
+        draw_text_(draw_ctx, &area, text_.c_str(), &Font16, LV_OPA_COVER);
+    } else if (!icon_.empty()) {
+        area.y1 = coords->y2 - Material24.line_height + 1;
+        draw_text_(draw_ctx, &area, icon_.c_str(), &Material24, LV_OPA_COVER);
+    }
+}
+
+void HdSlider::on_drawn_press_(lv_event_t *e) {
+    auto obj = (HdSlider*)lv_event_get_user_data(e);
+    lv_point_t point;
+    lv_indev_get_point(lv_indev_get_act(), &point);
+
+    lv_area_t track;
+    obj->get_track_area_(&obj->slider_panel_->coords, &track);
+    // Top row is max, bottom row is min, rounded to the nearest step
+    lv_coord_t span = std::max<lv_coord_t>(lv_area_get_height(&track) - 1, 1);
+    lv_coord_t y = std::max(track.y1, std::min(track.y2, point.y));
+    int value = obj->min_ + ((track.y2 - y) * (obj->max_ - obj->min_) + span / 2) / span;
+    if (value != obj->value_)
+        obj->set_value(value);
+}
+
 void HdSlider::destroy_() {
     lv_obj_del(slider_panel_);
     slider_panel_ = nullptr;
 }
 
 void HdSlider::update_() {
+    // The value under the finger wins until it's released
+    if (drawn_ && slider_panel_ && lv_obj_has_state(slider_panel_, LV_STATE_PRESSED))
+        return;
+
     if (this->value_fn_) {
         auto s = this->value_fn_();
         if (s.has_value() && s.value() != this->value_)
@@ -129,11 +213,13 @@ void HdSlider::set_enabled_(bool enabled) {
     } else {
         lv_obj_add_state(slider_panel_, LV_STATE_DISABLED);
     }
+    if (drawn_)
+        lv_obj_invalidate(slider_panel_);
 }
 
 void HdSlider::on_value_change_(lv_event_t *e) {
     auto obj = (HdSlider*)lv_event_get_user_data(e);
-    auto value = lv_slider_get_value(obj->slider_);
+    auto value = obj->drawn_ ? obj->value_ : lv_slider_get_value(obj->slider_);
     
     obj->value_change_callback_.call(value);
 }
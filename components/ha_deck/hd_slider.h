@@ -23,8 +23,12 @@ protected:
     void update_();
     void set_visible_(bool visible);
     void set_enabled_(bool enabled);
+    void draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords);
 private:
     static void on_value_change_(lv_event_t *e);
+    static void on_drawn_press_(lv_event_t *e);
+    void render_drawn_();
+    void get_track_area_(const lv_area_t *coords, lv_area_t *area);
 
     const char *TAG = "HD_SLIDER";
     std::string text_;
@@ -33,8 +37,8 @@ private:
     int min_ = 0;
     int max_ = 1;
 
-    lv_obj_t *slider_panel_;
-    lv_obj_t *slider_;
+    lv_obj_t *slider_panel_ = nullptr;
+    lv_obj_t *slider_ = nullptr;
 
     std::function<optional<int>()> value_fn_ = nullptr;
     CallbackManager<void(int)> value_change_callback_{};
@@ -23,6 +23,7 @@ CONF_MIN = "min"
 CONF_MAX = "max"
 CONF_VALUE = "value"
 CONF_ON_CHANGE = "on_change"
+CONF_DRAWN = "drawn"
 
 SLIDER_CONFIG_SCHEMA = cv.Schema(
     {
@@ -32,6 +33,7 @@ SLIDER_CONFIG_SCHEMA = cv.Schema(
         cv.Required(CONF_MIN): cv.int_,
         cv.Required(CONF_MAX): cv.int_,
         cv.Optional(CONF_VALUE): cv.returning_lambda,
+        cv.Optional(CONF_DRAWN, default=False): cv.boolean,
         cv.Optional(CONF_ON_CHANGE): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(SliderChangeTrigger),
@@ -52,6 +54,8 @@ async def build_slider(var, config):
 
     max_ = config.get(CONF_MAX)
     cg.add(var.set_max(max_))
+    if config[CONF_DRAWN]:
+        cg.add(var.set_drawn(True))
 
     if CONF_VALUE in config:
         val = await cg.process_lambda(
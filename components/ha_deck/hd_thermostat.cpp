@@ -0,0 +1,219 @@
+#include "hd_thermostat.h"
+#include "esphome/core/hal.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace esphome {
+namespace ha_deck {
+
+// How long the local setpoint wins over the reported one after it was sent
+static const uint32_t PENDING_TIME = 5000;
+
+void HdThermostat::set_text(std::string text) {
+    text_ = text;
+}
+
+void HdThermostat::set_unit(std::string unit) {
+    unit_ = unit;
+}
+
+void HdThermostat::set_min(float min) {
+    min_ = min;
+}
+
+void HdThermostat::set_max(float max) {
+    max_ = max;
+}
+
+void HdThermostat::set_step(float step) {
+    step_ = step;
+}
+
+void HdThermostat::set_settle_time(uint32_t ms) {
+    settle_time_ = ms;
+}
+
+float HdThermostat::get_target() {
+    return target_;
+}
+
+void HdThermostat::add_current_lambda(std::function<optional<float>()> &&f) {
+    this->current_fn_ = f;
+}
+
+void HdThermostat::add_target_lambda(std::function<optional<float>()> &&f) {
+    this->target_fn_ = f;
+}
+
+void HdThermostat::add_on_change_callback(std::function<void(float)> &&callback) {
+    this->change_callback_.add(std::move(callback));
+}
+
+void HdThermostat::render_() {
+    lv_main_ = create_drawn_obj_(w_ > 0 ? w_ : 228, h_ > 0 ? h_ : 96);
+    lv_obj_add_event_cb(lv_main_, HdThermostat::on_press_, LV_EVENT_PRESSED, this);
+    // Held down, keeps stepping
+    lv_obj_add_event_cb(lv_main_, HdThermostat::on_press_, LV_EVENT_LONG_PRESSED_REPEAT, this);
+
+    set_visible(visible_);
+    set_enabled(enabled_);
+}
+
+void HdThermostat::update_() {
+    if (this->current_fn_) {
+        auto s = this->current_fn_();
+        if (s.has_value() && s.value() != this->current_ && !(std::isnan(s.value()) && std::isnan(this->current_)))
+            this->set_current_(s.value());
+    }
+    // Wraparound-safe, and cleared once elapsed so it can't match again 49 days later
+    if (sent_ && millis() - sent_at_ >= PENDING_TIME)
+        sent_ = false;
+    if (this->target_fn_ && !editing_ && !sent_) {
+        auto s = this->target_fn_();
+        if (s.has_value() && s.value() != this->target_ && !(std::isnan(s.value()) && std::isnan(this->target_)))
+            this->set_target_(s.value());
+    }
+}
+
+void HdThermostat::adjust_(int steps) {
+    // Starts from the current temperature if the device hasn't reported a setpoint yet
+    float target = !std::isnan(target_) ? target_ + steps * step_ : !std::isnan(current_) ? current_ : min_;
+    target = std::max(min_, std::min(max_, roundf(target / step_) * step_));
+    if (target == target_)
+        return;
+
+    set_target_(target);
+    // Several taps within the settle time are sent as one update
+    editing_ = true;
+    this->set_timeout("setpoint", settle_time_, [this]() {
+        editing_ = false;
+        sent_ = true;
+        sent_at_ = millis();
+        ESP_LOGD(this->TAG, "Setpoint %.1f", target_);
+        change_callback_.call(target_);
+    });
+}
+
+void HdThermostat::set_current_(float value) {
+    current_ = value;
+    if (!lv_main_)
+        return;
+
+    lv_area_t area;
+    get_current_area_(&lv_main_->coords, &area);
+    lv_obj_invalidate_area(lv_main_, &area);
+}
+
+void HdThermostat::set_target_(float value) {
+    target_ = value;
+    if (!lv_main_)
+        return;
+
+    lv_area_t area;
+    get_target_area_(&lv_main_->coords, &area);
+    lv_obj_invalidate_area(lv_main_, &area);
+}
+
+void HdThermostat::format_(char *buf, size_t size, float value) {
+    // Sources publish after the UI is up, show a placeholder until then
+    if (std::isnan(value)) {
+        snprintf(buf, size, "-");
+        return;
+    }
+    snprintf(buf, size, "%.*f%s", step_ < 1 ? 1 : 0, value, unit_.c_str());
+}
+
+void HdThermostat::get_target_area_(const lv_area_t *coords, lv_area_t *area) {
+    // Same value row as a value card: 10px padding, 64px high
+    lv_coord_t third = lv_area_get_width(coords) / 3;
+    area->x1 = coords->x1 + third;
+    area->x2 = coords->x2 - third;
+    area->y1 = coords->y1 + 10;
+    area->y2 = area->y1 + 63;
+}
+
+void HdThermostat::get_current_area_(const lv_area_t *coords, lv_area_t *area) {
+    *area = *coords;
+    area->y2 -= 13;
+    area->y1 = area->y2 - Font16.line_height + 1;
+}
+
+void HdThermostat::draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords) {
+    draw_background_(draw_ctx, coords, lv_color_hex(0x999999), 25);
+    bool disabled = lv_obj_has_state(lv_main_, LV_STATE_DISABLED);
+    lv_opa_t opa = disabled ? 150 : LV_OPA_COVER;
+    char buf[24];
+
+    lv_area_t row;
+    get_target_area_(coords, &row);
+    format_(buf, sizeof(buf), target_);
+    lv_area_t area = row;
+    area.y1 = row.y2 - Font24.line_height + 1;
+    draw_text_(draw_ctx, &area, buf, &Font24, opa);
+
+    // -/+ on the left and right thirds, which are also the touch areas
+    area.x1 = coords->x1;
+    area.x2 = row.x1 - 1;
+    draw_text_(draw_ctx, &area, "-", &Font24, opa);
+    area.x1 = row.x2 + 1;
+    area.x2 = coords->x2;
+    draw_text_(draw_ctx, &area, "+", &Font24, opa);
+
+    get_current_area_(coords, &area);
+    if (text_.empty()) {
+        format_(buf, sizeof(buf), current_);
+    } else {
+        char value[16];
+        format_(value, sizeof(value), current_);
+        snprintf(buf, sizeof(buf), "%s %s", text_.c_str(), value);
+    }
+    draw_text_(draw_ctx, &area, buf, &Font16, opa);
+}
+
+void HdThermostat::destroy_() {
+    lv_obj_del(lv_main_);
+    lv_main_ = nullptr;
+}
+
+void HdThermostat::set_visible_(bool visible) {
+    if (!lv_main_)
+        return;
+
+    if (visible) {
+        lv_obj_clear_flag(lv_main_, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(lv_main_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void HdThermostat::set_enabled_(bool enabled) {
+    if (!lv_main_)
+        return;
+
+    if (enabled) {
+        lv_obj_clear_state(lv_main_, LV_STATE_DISABLED);
+    } else {
+        lv_obj_add_state(lv_main_, LV_STATE_DISABLED);
+    }
+    lv_obj_invalidate(lv_main_);
+}
+
+void HdThermostat::on_press_(lv_event_t *e) {
+    auto obj = (HdThermostat*)lv_event_get_user_data(e);
+    if (lv_obj_has_state(obj->lv_main_, LV_STATE_DISABLED))
+        return;
+
+    lv_point_t point;
+    lv_indev_get_point(lv_indev_get_act(), &point);
+    lv_area_t row;
+    obj->get_target_area_(&obj->lv_main_->coords, &row);
+    if (point.x < row.x1) {
+        obj->adjust_(-1);
+    } else if (point.x > row.x2) {
+        obj->adjust_(1);
+    }
+}
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "ha_deck_widget.h"
+
+namespace esphome {
+namespace ha_deck {
+
+// Current and target temperature with -/+ controls in one drawn object. The setpoint is
+// changed locally and reported once, after the adjustments have settled.
+class HdThermostat : public HaDeckWidget
+{
+public:
+    void set_text(std::string text);
+    void set_unit(std::string unit);
+    void set_min(float min);
+    void set_max(float max);
+    void set_step(float step);
+    void set_settle_time(uint32_t ms);
+    float get_target();
+
+    void add_current_lambda(std::function<optional<float>()> &&f);
+    void add_target_lambda(std::function<optional<float>()> &&f);
+    void add_on_change_callback(std::function<void(float)> &&callback);
+protected:
+    void render_();
+    void destroy_();
+    void update_();
+    void set_visible_(bool visible);
+    void set_enabled_(bool enabled);
+    void draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords);
+private:
+    static void on_press_(lv_event_t *e);
+
+    void adjust_(int steps);
+    void set_current_(float value);
+    void set_target_(float value);
+    // Target in the middle column, current below it
+    void get_target_area_(const lv_area_t *coords, lv_area_t *area);
+    void get_current_area_(const lv_area_t *coords, lv_area_t *area);
+    void format_(char *buf, size_t size, float value);
+
+    const char *TAG = "HD_THERMOSTAT";
+    std::string text_;
+    std::string unit_;
+    float min_ = 5;
+    float max_ = 30;
+    float step_ = 0.5f;
+    uint32_t settle_time_ = 1000;
+    float current_ = NAN;
+    float target_ = NAN;
+    // Reported values are ignored while the setpoint is being changed locally,
+    // and until the device has had PENDING_TIME to catch up with it
+    bool editing_ = false;
+    bool sent_ = false;
+    uint32_t sent_at_ = 0;
+
+    lv_obj_t *lv_main_ = nullptr;
+
+    std::function<optional<float>()> current_fn_ = nullptr;
+    std::function<optional<float>()> target_fn_ = nullptr;
+    CallbackManager<void(float)> change_callback_{};
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -0,0 +1,78 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome import automation
+from esphome.const import (
+    CONF_ID,
+    CONF_MIN_VALUE,
+    CONF_MAX_VALUE,
+    CONF_STEP,
+    CONF_TRIGGER_ID,
+)
+
+from .ha_deck import ha_deck_ns, HaDeckWidget
+
+HdThermostat = ha_deck_ns.class_("HdThermostat", HaDeckWidget)
+
+ThermostatChangeTrigger = ha_deck_ns.class_(
+    "HdThermostatChangeTrigger", automation.Trigger.template(cg.float_)
+)
+
+CONF_TEXT = "text"
+CONF_UNIT = "unit"
+CONF_CURRENT = "current"
+CONF_TARGET = "target"
+CONF_SETTLE_TIME = "settle_time"
+CONF_ON_CHANGE = "on_change"
+
+def validate_thermostat(config):
+    if config[CONF_MIN_VALUE] >= config[CONF_MAX_VALUE]:
+        raise cv.Invalid(f"{CONF_MIN_VALUE} has to be less than {CONF_MAX_VALUE}")
+    return config
+
+THERMOSTAT_CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_ID): cv.declare_id(HdThermostat),
+        cv.Optional(CONF_TEXT): cv.string,
+        cv.Optional(CONF_UNIT): cv.string,
+        cv.Optional(CONF_MIN_VALUE, default=5): cv.float_,
+        cv.Optional(CONF_MAX_VALUE, default=30): cv.float_,
+        cv.Optional(CONF_STEP, default=0.5): cv.positive_float,
+        cv.Optional(CONF_CURRENT): cv.returning_lambda,
+        cv.Optional(CONF_TARGET): cv.returning_lambda,
+        # Taps within this time are sent as a single change
+        cv.Optional(CONF_SETTLE_TIME, default="1s"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_ON_CHANGE): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ThermostatChangeTrigger),
+            }
+        ),
+    }
+)
+
+async def build_thermostat(var, config):
+    if text := config.get(CONF_TEXT):
+        cg.add(var.set_text(text))
+
+    if unit := config.get(CONF_UNIT):
+        cg.add(var.set_unit(unit))
+
+    cg.add(var.set_min(config[CONF_MIN_VALUE]))
+    cg.add(var.set_max(config[CONF_MAX_VALUE]))
+    cg.add(var.set_step(config[CONF_STEP]))
+    cg.add(var.set_settle_time(config[CONF_SETTLE_TIME].total_milliseconds))
+
+    if CONF_CURRENT in config:
+        current = await cg.process_lambda(
+                config[CONF_CURRENT], [], return_type=cg.optional.template(float)
+            )
+        cg.add(var.add_current_lambda(current))
+
+    if CONF_TARGET in config:
+        target = await cg.process_lambda(
+                config[CONF_TARGET], [], return_type=cg.optional.template(float)
+            )
+        cg.add(var.add_target_lambda(target))
+
+    for conf in config.get(CONF_ON_CHANGE, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(trigger, [(float, "x")], conf)
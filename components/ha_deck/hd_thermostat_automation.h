@@ -0,0 +1,18 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "hd_thermostat.h"
+
+namespace esphome {
+namespace ha_deck {
+
+class HdThermostatChangeTrigger : public Trigger<float> {
+ public:
+  HdThermostatChangeTrigger(HdThermostat *thermostat) {
+    thermostat->add_on_change_callback([this](float value) { this->trigger(value); });
+  }
+};
+
+}  // namespace ha_deck
+}  // namespace esphome
@@ -24,12 +24,31 @@ void HdValueCard::set_value_(std::string value) {
     
     if (!lv_main_)
         return;
-    
-    lv_label_set_text(lv_value_, value_.c_str());
+
+    if (drawn_) {
+        // Only the value row changes
+        lv_area_t area;
+        get_value_area_(&lv_main_->coords, &area);
+        lv_obj_invalidate_area(lv_main_, &area);
+        return;
+    }
+    lv_label_set_text(lv_value_, get_display_value_());
+}
+
+const char *HdValueCard::get_display_value_() {
+    // Sources publish after the UI is up, show a placeholder until then
+    if (value_.empty() || value_ == "nan")
+        return "-";
+    return value_.c_str();
 }
 
 void HdValueCard::render_() {
-    lv_main_ = lv_obj_create(lv_scr_act());
+    if (drawn_) {
+        render_drawn_();
+        return;
+    }
+
+    lv_main_ = lv_obj_create(parent_);
     lv_obj_add_flag(lv_main_, LV_OBJ_FLAG_CLICKABLE);
 
     lv_obj_add_event_cb(lv_main_, HdValueCard::on_click_, LV_EVENT_SHORT_CLICKED, this);
@@ -71,7 +90,7 @@ void HdValueCard::render_() {
     lv_obj_set_x(lv_value_, 0);
     lv_obj_set_y(lv_value_, 5);
     lv_obj_set_align(lv_value_, LV_ALIGN_CENTER);
-    lv_label_set_text(lv_value_, value_.c_str());
+    lv_label_set_text(lv_value_, get_display_value_());
     lv_obj_set_style_text_color(lv_value_, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_text_opa(lv_value_, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_text_font(lv_value_, &Font24, LV_PART_MAIN | LV_STATE_DEFAULT);
@@ -143,6 +162,61 @@ void HdValueCard::render_() {
     }
 }
 
+void HdValueCard::render_drawn_() {
+    lv_main_ = create_drawn_obj_(w_ > 0 ? w_ : 110, h_ > 0 ? h_ : 96);
+    lv_obj_add_event_cb(lv_main_, HdValueCard::on_click_, LV_EVENT_SHORT_CLICKED, this);
+
+    if (enabled_) {
+        lv_obj_clear_state(lv_main_, LV_STATE_DISABLED);
+    } else {
+        lv_obj_add_state(lv_main_, LV_STATE_DISABLED);
+    }
+}
+
+void HdValueCard::get_value_area_(const lv_area_t *coords, lv_area_t *area) {
+    // Same layout as the object tree: 10px padding, 64px value row
+    *area = *coords;
+    area->y1 += 10;
+    area->y2 = area->y1 + 63;
+}
+
+void HdValueCard::draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords) {
+    draw_background_(draw_ctx, coords, lv_color_hex(0x999999), 25);
+
+    // Value and unit are centered as a group and share the bottom line of the row
+    lv_area_t row;
+    get_value_area_(coords, &row);
+    const char *value = get_display_value_();
+    lv_coord_t value_w = get_text_width_(value, &Font24);
+    lv_coord_t unit_w = unit_.empty() ? 0 : get_text_width_(unit_.c_str(), &Font16) + 4;
+    lv_coord_t x = (row.x1 + row.x2 - value_w - unit_w) / 2;
+
+    lv_area_t area = {x, (lv_coord_t)(row.y2 - Font24.line_height + 1), (lv_coord_t)(x + value_w), row.y2};
+    draw_text_(draw_ctx, &area, value, &Font24, LV_OPA_COVER);
+    if (!unit_.empty()) {
+        area = {(lv_coord_t)(x + value_w + 4), (lv_coord_t)(row.y2 - Font16.line_height + 1),
+            (lv_coord_t)(x + value_w + unit_w), row.y2};
+        draw_text_(draw_ctx, &area, unit_.c_str(), &Font16, LV_OPA_COVER);
+    }
+
+    // Icon and text in a 24px row at the bottom
+    lv_coord_t bottom = coords->y2 - 13;
+    lv_coord_t icon_w = icon_.empty() ? 0 : get_text_width_(icon_.c_str(), &Material24);
+    lv_coord_t text_w = text_.empty() ? 0 : get_text_width_(text_.c_str(), &Font16);
+    lv_coord_t gap = icon_w > 0 && text_w > 0 ? 4 : 0;
+    x = (coords->x1 + coords->x2 - icon_w - gap - text_w) / 2;
+
+    if (icon_w > 0) {
+        area = {x, (lv_coord_t)(bottom - Material24.line_height + 1), (lv_coord_t)(x + icon_w), bottom};
+        draw_text_(draw_ctx, &area, icon_.c_str(), &Material24, LV_OPA_COVER);
+    }
+    if (text_w > 0) {
+        x += icon_w + gap;
+        area = {x, (lv_coord_t)(bottom - Font16.line_height + 1), (lv_coord_t)(x + text_w), bottom};
+        draw_text_(draw_ctx, &area, text_.c_str(), &Font16, LV_OPA_COVER);
+    }
+}
+
 void HdValueCard::destroy_() {
     lv_obj_del(lv_main_);
     lv_main_ = nullptr;
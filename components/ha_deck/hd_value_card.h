@@ -21,9 +21,13 @@ protected:
     void update_();
     void set_visible_(bool visible);
     void set_enabled_(bool enabled);
+    void draw_(lv_draw_ctx_t *draw_ctx, const lv_area_t *coords);
     void set_value_(std::string value);
+    const char *get_display_value_();
 private:
     static void on_click_(lv_event_t *e);
+    void render_drawn_();
+    void get_value_area_(const lv_area_t *coords, lv_area_t *area);
 
     const char *TAG = "HD_VALUE_CARD";
     std::string text_;
@@ -31,8 +35,8 @@ private:
     std::string unit_;
     std::string value_;
 
-    lv_obj_t *lv_main_;
-    lv_obj_t *lv_value_;
+    lv_obj_t *lv_main_ = nullptr;
+    lv_obj_t *lv_value_ = nullptr;
 
     std::function<optional<std::string>()> value_fn_ = nullptr;
     CallbackManager<void()> click_callback_{};
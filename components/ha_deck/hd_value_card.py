@@ -21,6 +21,7 @@ CONF_TEXT = "text"
 CONF_UNIT = "unit"
 CONF_VALUE = "value"
 CONF_ON_CLICK = "on_click"
+CONF_DRAWN = "drawn"
 
 VALUE_CARD_CONFIG_SCHEMA = cv.Schema(
     {
@@ -29,6 +30,7 @@ VALUE_CARD_CONFIG_SCHEMA = cv.Schema(
         cv.Optional(CONF_ICON): cv.string,
         cv.Optional(CONF_UNIT): cv.string,
         cv.Optional(CONF_VALUE): cv.returning_lambda,
+        cv.Optional(CONF_DRAWN, default=False): cv.boolean,
         cv.Optional(CONF_ON_CLICK): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ValueCardClickTrigger),
@@ -46,6 +48,8 @@ async def build_value_card(var, config):
 
     if unit := config.get(CONF_UNIT):
         cg.add(var.set_unit(unit))
+    if config[CONF_DRAWN]:
+        cg.add(var.set_drawn(True))
 
     if CONF_VALUE in config:
         val = await cg.process_lambda(
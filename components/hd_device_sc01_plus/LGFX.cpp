@@ -7,7 +7,7 @@ LGFX::LGFX(void)
 {
   {
     auto cfg = _bus_instance.config();
-    cfg.freq_write = 20000000;  // Back to 20MHz from 40MHz
+    cfg.freq_write = 20000000;  // Default, see set_write_freq()
     cfg.freq_read  = 10000000;  // Back to 10MHz from 20MHz
     cfg.pin_wr = 47;
     cfg.pin_rd = -1;
@@ -41,7 +41,7 @@ LGFX::LGFX(void)
     cfg.offset_rotation = 0;
     cfg.dummy_read_pixel = 8;
     cfg.dummy_read_bits = 1;
-    cfg.readable = true;
+    cfg.readable = false;  // RD isn't routed on the SC01 Plus
     cfg.invert = true;
     cfg.rgb_order = false;
     cfg.dlen_16bit = false;
@@ -69,7 +69,7 @@ LGFX::LGFX(void)
     cfg.x_max = 319;
     cfg.y_min = 0;
     cfg.y_max = 479;
-    cfg.pin_int = 7;
+    cfg.pin_int = TOUCH_INT;
     cfg.bus_shared = true;
     cfg.offset_rotation = 0;
 
@@ -85,5 +85,17 @@ LGFX::LGFX(void)
   setPanel(&_panel_instance);
 }
 
+uint32_t LGFX::get_write_freq(void)
+{
+  return _bus_instance.config().freq_write;
+}
+
+void LGFX::set_write_freq(uint32_t freq)
+{
+  auto cfg = _bus_instance.config();
+  cfg.freq_write = freq;
+  _bus_instance.config(cfg);
+}
+
 }  // namespace ha_deck
 }  // namespace esphome
@@ -7,6 +7,9 @@
 
 #define TFT_WIDTH 320
 #define TFT_HEIGHT 480
+#define TOUCH_INT 7
+// Landscape, matches the orientation of LVGL's LV_DISP_ROT_90
+#define TFT_ROTATION 1
 
 namespace esphome {
 namespace hd_device {
@@ -20,6 +23,10 @@ class LGFX : public lgfx::LGFX_Device
 
 public:
   LGFX(void);
+
+  uint32_t get_write_freq(void);
+  // Changes the 8080 write clock, call before init()
+  void set_write_freq(uint32_t freq);
 };
 
 }  // namespace hd_device
@@ -5,21 +5,105 @@ import esphome.config_validation as cv
 import esphome.core as core
 import esphome.core.config as cfg
 from esphome.core import CORE, coroutine_with_priority
+from esphome.components import sensor
 from esphome.const import (
     CONF_ID,
-    CONF_BRIGHTNESS
+    CONF_BRIGHTNESS,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_MILLISECOND,
+    UNIT_PERCENT,
 )
 
+CONF_DRAW_BUFFER = "draw_buffer"
+CONF_LINES = "lines"
+CONF_COUNT = "count"
+CONF_MEMORY = "memory"
+CONF_FULL_FRAME = "full_frame"
+CONF_BENCHMARK = "benchmark"
+CONF_ROTATION = "rotation"
+CONF_BUS_FREQUENCY = "bus_frequency"
+CONF_TIME_TO_FIRST_FRAME = "time_to_first_frame"
+
+DRAW_BUFFER_MEMORY = {
+    "internal": False,
+    "psram": True,
+}
+
+ROTATION_HARDWARE = {
+    "software": False,
+    "hardware": True,
+}
+
+CONF_REFRESH = "refresh"
+CONF_ACTIVE_PERIOD = "active_period"
+CONF_IDLE_PERIOD = "idle_period"
+CONF_IDLE_TIMEOUT = "idle_timeout"
+CONF_IDLE_RATIO = "idle_ratio"
+
+CONF_SPLASH = "splash"
+CONF_DELAY = "delay"
+CONF_MIN_INTERVAL = "min_interval"
+CONF_HOLD_TIMEOUT = "hold_timeout"
+
 
 CODEOWNERS = ["@strange-v"]
+AUTO_LOAD = ["sensor"]
 
 hd_device_ns = cg.esphome_ns.namespace("hd_device")
 HaDeckDevice = hd_device_ns.class_("HaDeckDevice", cg.Component)
 
+REFRESH_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_ACTIVE_PERIOD, default="10ms"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_IDLE_PERIOD, default="100ms"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_IDLE_TIMEOUT, default="500ms"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_IDLE_RATIO): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PERCENT,
+            icon="mdi:sleep",
+            accuracy_decimals=1,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+)
+
+SPLASH_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_DELAY, default="10s"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_MIN_INTERVAL, default="10min"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_HOLD_TIMEOUT, default="15s"): cv.positive_time_period_milliseconds,
+    }
+)
+
+DRAW_BUFFER_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_LINES, default=20): cv.int_range(min=4, max=320),
+        cv.Optional(CONF_COUNT, default=1): cv.int_range(min=1, max=2),
+        cv.Optional(CONF_MEMORY, default="internal"): cv.one_of(*DRAW_BUFFER_MEMORY, lower=True),
+        cv.Optional(CONF_FULL_FRAME, default=False): cv.boolean,
+    }
+)
+
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(HaDeckDevice),
         cv.Required(CONF_BRIGHTNESS): cv.int_range(min=0, max=100),  # Changed min back to 0
+        cv.Optional(CONF_DRAW_BUFFER, default={}): DRAW_BUFFER_SCHEMA,
+        cv.Optional(CONF_BENCHMARK, default=False): cv.boolean,
+        cv.Optional(CONF_ROTATION, default="hardware"): cv.one_of(*ROTATION_HARDWARE, lower=True),
+        cv.Optional(CONF_BUS_FREQUENCY, default="20MHz"): cv.All(
+            cv.frequency, cv.Range(min=1e6, max=40e6)
+        ),
+        cv.Optional(CONF_TIME_TO_FIRST_FRAME): sensor.sensor_schema(
+            unit_of_measurement=UNIT_MILLISECOND,
+            icon="mdi:timer-outline",
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_REFRESH, default={}): REFRESH_SCHEMA,
+        cv.Optional(CONF_SPLASH): SPLASH_SCHEMA,
     }
 )
 
@@ -45,3 +129,30 @@ async def to_code(config):
 
     brightness = config.get(CONF_BRIGHTNESS)
     cg.add(var.set_brightness(brightness))
+
+    draw_buffer = config[CONF_DRAW_BUFFER]
+    cg.add(var.set_draw_buffer_lines(draw_buffer[CONF_LINES]))
+    cg.add(var.set_draw_buffer_count(draw_buffer[CONF_COUNT]))
+    cg.add(var.set_draw_buffer_psram(DRAW_BUFFER_MEMORY[draw_buffer[CONF_MEMORY]]))
+    cg.add(var.set_full_frame(draw_buffer[CONF_FULL_FRAME]))
+    cg.add(var.set_benchmark(config[CONF_BENCHMARK]))
+    cg.add(var.set_hardware_rotation(ROTATION_HARDWARE[config[CONF_ROTATION]]))
+    cg.add(var.set_bus_frequency(int(config[CONF_BUS_FREQUENCY])))
+
+    refresh = config[CONF_REFRESH]
+    cg.add(var.set_refresh_active_period(refresh[CONF_ACTIVE_PERIOD].total_milliseconds))
+    cg.add(var.set_refresh_idle_period(refresh[CONF_IDLE_PERIOD].total_milliseconds))
+    cg.add(var.set_refresh_idle_timeout(refresh[CONF_IDLE_TIMEOUT].total_milliseconds))
+    if idle_ratio := refresh.get(CONF_IDLE_RATIO):
+        sens = await sensor.new_sensor(idle_ratio)
+        cg.add(var.set_refresh_idle_ratio_sensor(sens))
+
+    if splash := config.get(CONF_SPLASH):
+        cg.add(var.set_splash(True))
+        cg.add(var.set_splash_delay(splash[CONF_DELAY].total_milliseconds))
+        cg.add(var.set_splash_min_interval(splash[CONF_MIN_INTERVAL].total_milliseconds))
+        cg.add(var.set_splash_hold_timeout(splash[CONF_HOLD_TIMEOUT].total_milliseconds))
+
+    if time_to_first_frame := config.get(CONF_TIME_TO_FIRST_FRAME):
+        sens = await sensor.new_sensor(time_to_first_frame)
+        cg.add(var.set_time_to_first_frame_sensor(sens))
@@ -1,42 +1,82 @@
 #include "hd_device_sc01_plus.h"
+#include <driver/gpio.h>
+#include <freertos/event_groups.h>
 
-#if CONFIG_SPIRAM_SUPPORT
-#define LVGL_BUFFER_SIZE (TFT_HEIGHT * 20)  // Changed from WIDTH to HEIGHT
-#else
-#define LVGL_BUFFER_SIZE (TFT_HEIGHT * 20)  // Changed from WIDTH to HEIGHT
-#endif
+// LVGL renders in landscape, so a line is TFT_HEIGHT pixels wide
+#define LVGL_LINE_WIDTH TFT_HEIGHT
+#define LVGL_LINES_MAX TFT_WIDTH
+#define LVGL_LINES_MIN 4
 
 namespace esphome {
 namespace hd_device {
 
+// Pixel type matching the byte order LVGL renders in (LV_COLOR_16_SWAP in lv_conf.h).
+// With the swapped order the panel takes LVGL's buffer as is.
+#if LV_COLOR_16_SWAP
+typedef lgfx::swap565_t panel_pixel_t;
+#else
+typedef lgfx::rgb565_t panel_pixel_t;
+#endif
+
 static const char *const TAG = "HD_DEVICE";
 static lv_disp_draw_buf_t draw_buf;
-// Optimize buffer size
-static lv_color_t *buf = (lv_color_t *)heap_caps_malloc(
-    LVGL_BUFFER_SIZE * sizeof(lv_color_t), 
-    MALLOC_CAP_DMA | MALLOC_CAP_32BIT
-);
 
 LGFX lcd;
 
 lv_disp_t *indev_disp;
 lv_group_t *group;
 
-// Add boot time measurement
-static unsigned long boot_start_time = 0;
+LV_FONT_DECLARE(Font16);
+LV_FONT_DECLARE(Font24);
+LV_FONT_DECLARE(Material24);
+LV_FONT_DECLARE(Material48);
+
+// Boot pipeline barriers, set by the init task running on core 0
+static EventGroupHandle_t boot_events = nullptr;
+static const EventBits_t BOOT_LVGL_READY = BIT0;
+static const EventBits_t BOOT_FONTS_READY = BIT1;
+static const uint32_t BOOT_TIMEOUT_MS = 3000;
+
+// Time since power-on when the first complete frame reached the panel
+static uint32_t first_frame_ms = 0;
+
+// Pixels flushed, counted for the benchmark
+static uint32_t flush_pixel_count = 0;
+
+// While the stored splash is on the panel, LVGL renders but nothing is pushed
+// until the UI reports it's ready
+static bool splash_hold = false;
+// Set by every flush, cleared once the frame was captured for the splash
+static bool frame_changed = false;
+// Set by the deck on the LVGL screen while its main screen is built and shown on its own
+static const lv_obj_flag_t DECK_SETTLED_FLAG = LV_OBJ_FLAG_USER_1;
 
 void IRAM_ATTR flush_pixels(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
 {
+    if (splash_hold) {
+        lv_disp_flush_ready(disp);
+        return;
+    }
+
     // Pre-calculate dimensions once
     const uint32_t w = (area->x2 - area->x1 + 1);
     const uint32_t h = (area->y2 - area->y1 + 1);
     const uint32_t len = w * h;
 
-    // Use direct memory writes where possible
-    lcd.startWrite();
-    lcd.setAddrWindow(area->x1, area->y1, w, h);
-    lcd.writePixels((uint16_t *)color_p, len, true);  // Removed the &color_p->full
-    lcd.endWrite();
+    lcd.pushImageDMA(area->x1, area->y1, w, h, (const panel_pixel_t *)color_p);
+
+    // With a single buffer LVGL would start rendering into it right away, so wait
+    // for the transfer. With two, LovyanGFX waits before starting the next one.
+    // Software rotation hands over LVGL's own rotation buffer, which it reuses as
+    // soon as the flush is reported ready, whatever the buffer count.
+    if (disp->draw_buf->buf2 == nullptr || disp->sw_rotate)
+        lcd.waitDMA();
+
+    frame_changed = true;
+    flush_pixel_count += len;
+
+    if (first_frame_ms == 0 && lv_disp_flush_is_last(disp))
+        first_frame_ms = millis();
 
     lv_disp_flush_ready(disp);
 }
@@ -58,52 +98,86 @@ void IRAM_ATTR touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data
 
     last_read = now;
     last_touched = lcd.getTouch(&last_x, &last_y);
-    
-    if (last_touched) {
-        // Wake screen on touch if brightness is 0
-        if (brightness_ == 0) {
-            brightness_ = 100;
-            lcd.setBrightness(brightness_);
-        }
-    }
-    
+
     data->point.x = last_x;
     data->point.y = last_y;
     data->state = last_touched ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
 }
 
+// Pre-fault the font tables so the first render doesn't stall on flash cache misses
+static void warm_up_fonts()
+{
+    static const lv_font_t *fonts[] = {&Font16, &Font24, &Material24, &Material48};
+    volatile uint8_t sink = 0;
+    lv_font_glyph_dsc_t dsc;
+
+    for (auto font : fonts) {
+        for (uint32_t letter = 0x20; letter < 0x7F; letter++) {
+            if (!lv_font_get_glyph_dsc(font, &dsc, letter, 0))
+                continue;
+            const uint8_t *bitmap = lv_font_get_glyph_bitmap(font, letter);
+            if (bitmap)
+                sink += bitmap[0];
+        }
+    }
+}
+
 void HaDeckDevice::lvgl_init_task(void *param) {
+    auto device = (HaDeckDevice *) param;
+
     lv_init();
+    device->boot_phase_time_[BOOT_PHASE_LVGL] = millis() - device->boot_start_time_;
+    xEventGroupSetBits(boot_events, BOOT_LVGL_READY);
+
+    warm_up_fonts();
+    device->boot_phase_time_[BOOT_PHASE_FONTS] = millis() - device->boot_start_time_;
+    xEventGroupSetBits(boot_events, BOOT_FONTS_READY);
+
     vTaskDelete(nullptr);
 }
 
 void HaDeckDevice::setup() {
-    boot_start_time = millis();
+    boot_start_time_ = millis();
 
-    // Initialize LVGL and LCD in parallel using second core
-    TaskHandle_t task_handle;
+    // LVGL and fonts are brought up on core 0 while this core initializes
+    // the panel and touch controller, nothing may call into LVGL until
+    // the barrier below
+    boot_events = xEventGroupCreate();
     xTaskCreatePinnedToCore(
         lvgl_init_task,
         "lvgl_init",
         4096,
-        nullptr,
+        this,
         1,
-        &task_handle,
+        nullptr,
         0
     );
 
     // Initialize display on main core
+    lcd.set_write_freq(bus_frequency_);
     lcd.init();
+    ESP_LOGD(TAG, "Bus clock: %.1f MHz", get_bus_frequency() / 1e6f);
+    // Backlight goes on with the last frame already on the panel
+    bool splash_shown = splash_ && show_splash_();
     lcd.setBrightness(brightness_);
-    
-    lv_disp_draw_buf_init(&draw_buf, buf, NULL, LVGL_BUFFER_SIZE);
+    boot_phase_time_[BOOT_PHASE_PANEL] = millis() - boot_start_time_;
+
+    if (!setup_draw_buffers_()) {
+        mark_failed();
+        return;
+    }
+
+    const EventBits_t ready = BOOT_LVGL_READY | BOOT_FONTS_READY;
+    EventBits_t bits = xEventGroupWaitBits(boot_events, ready, pdFALSE, pdTRUE, pdMS_TO_TICKS(BOOT_TIMEOUT_MS));
+    if ((bits & ready) != ready) {
+        ESP_LOGE(TAG, "LVGL initialization timed out");
+        mark_failed();
+        return;
+    }
 
     static lv_disp_drv_t disp_drv;
     lv_disp_drv_init(&disp_drv);
-    disp_drv.hor_res = TFT_WIDTH;
-    disp_drv.ver_res = TFT_HEIGHT;
-    disp_drv.rotated = 1;
-    disp_drv.sw_rotate = 1;
+    configure_rotation_(&disp_drv, hardware_rotation_);
     disp_drv.flush_cb = flush_pixels;
     disp_drv.draw_buf = &draw_buf;
     lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
@@ -118,37 +192,81 @@ void HaDeckDevice::setup() {
     lv_group_set_default(group);
 
     lv_theme_default_init(disp, lv_color_hex(0xFFEB3B), lv_color_hex(0xFF7043), 1, LV_FONT_DEFAULT);
+    boot_phase_time_[BOOT_PHASE_DISPLAY] = millis() - boot_start_time_;
+
+    if (benchmark_) {
+        run_bus_benchmark_();
+        run_benchmark_(disp);
+        run_rotation_benchmark_(disp);
+    }
+
+    if (splash_) {
+        splash_screen_ = lv_scr_act();
+        lv_obj_add_event_cb(splash_screen_, splash_ready_cb, LV_EVENT_READY, this);
+        splash_hold = splash_shown;
+    }
+
+    refresh_mode_since_ = millis();
+    last_activity_ = refresh_mode_since_;
 
-    ESP_LOGD(TAG, "Boot completed in %lums", millis() - boot_start_time);
+    ESP_LOGD(TAG, "Boot completed in %lums (panel %u ms, LVGL %u ms, fonts %u ms)",
+        millis() - boot_start_time_, boot_phase_time_[BOOT_PHASE_PANEL],
+        boot_phase_time_[BOOT_PHASE_LVGL], boot_phase_time_[BOOT_PHASE_FONTS]);
 }
 
 // Add display backlight auto-dimming
 void HaDeckDevice::loop() {
-    static unsigned long last_tick = 0;
-    static unsigned long last_touch = 0;
     static uint8_t current_brightness = brightness_;
-    unsigned long now = millis();
-    
-    // Increase minimum update time
-    if (now - last_tick >= 10) {  // Changed from 5ms to 10ms
+    uint32_t now = millis();
+
+    // Back off to the slow tick once nothing has happened for a while,
+    // but wake up right away on touch, animation or invalidation
+    RefreshMode prev_mode = refresh_mode_;
+    if (has_activity_()) {
+        last_activity_ = now;
+        set_refresh_mode_(REFRESH_MODE_ACTIVE, now);
+    } else if (now - last_activity_ > refresh_idle_timeout_) {
+        set_refresh_mode_(REFRESH_MODE_IDLE, now);
+    }
+
+    if (splash_hold && now - boot_start_time_ > splash_hold_timeout_) {
+        ESP_LOGW(TAG, "UI not ready after %u ms, dropping the splash", splash_hold_timeout_);
+        release_splash_();
+    }
+
+    if (first_frame_ms > 0 && boot_phase_time_[BOOT_PHASE_FIRST_FRAME] == 0) {
+        boot_phase_time_[BOOT_PHASE_FIRST_FRAME] = first_frame_ms - boot_start_time_;
+        ESP_LOGD(TAG, "First frame %u ms after power-on (%u ms after device setup)",
+            first_frame_ms, boot_phase_time_[BOOT_PHASE_FIRST_FRAME]);
+#ifdef USE_SENSOR
+        if (time_to_first_frame_sensor_)
+            time_to_first_frame_sensor_->publish_state(first_frame_ms);
+#endif
+    }
+
+    uint32_t period = refresh_mode_ == REFRESH_MODE_ACTIVE
+        ? refresh_active_period_
+        : refresh_idle_period_;
+    bool woke_up = prev_mode == REFRESH_MODE_IDLE && refresh_mode_ == REFRESH_MODE_ACTIVE;
+
+    if (woke_up || now - last_tick_ >= period) {
         lv_timer_handler();
-        last_tick = now;
+        last_tick_ = now;
         
-        // Check for touch to reset dimming timer
-        uint16_t x, y;
-        if (lcd.getTouch(&x, &y)) {
-            last_touch = now;
+        // LVGL tracks the last touch already, no need for an extra touch read
+        if (lv_disp_get_inactive_time(NULL) < 30000) {
             if (current_brightness != brightness_) {
                 lcd.setBrightness(brightness_);
                 current_brightness = brightness_;
             }
-        }
-        
-        // Auto-dim after 30 seconds
-        if (now - last_touch > 30000 && current_brightness > 20) {
+        } else if (current_brightness > 20) {
+            // Auto-dim after 30 seconds
             current_brightness = 20;
             lcd.setBrightness(current_brightness);
         }
+
+        if (splash_ && !splash_hold)
+            capture_splash_(now);
     }
 
     // Reduce logging frequency
@@ -171,11 +289,18 @@ void HaDeckDevice::loop() {
         ESP_LOGD(TAG, "  Free Heap: %u bytes (Min: %u bytes)", free_heap, min_free_heap);
         ESP_LOGD(TAG, "  Heap Fragmentation: %.1f%%", heap_frag);
         ESP_LOGD(TAG, "  Free PSRAM: %u bytes", free_psram);
+        ESP_LOGD(TAG, "  Refresh: %s (active %u ms, idle %u ms)", get_refresh_mode_name(),
+            get_refresh_mode_time(REFRESH_MODE_ACTIVE), get_refresh_mode_time(REFRESH_MODE_IDLE));
         ESP_LOGD(TAG, "  Uptime: %lu ms", now);
+#ifdef USE_SENSOR
+        if (refresh_idle_ratio_sensor_)
+            refresh_idle_ratio_sensor_->publish_state(get_refresh_idle_ratio());
+#endif
     }
 }
 
-float HaDeckDevice::get_setup_priority() const { return setup_priority::DATA; }
+// As early as possible, the panel shows the stored splash until the UI is up
+float HaDeckDevice::get_setup_priority() const { return setup_priority::HARDWARE; }
 
 uint8_t HaDeckDevice::get_brightness() {
     return brightness_;
@@ -186,5 +311,357 @@ void HaDeckDevice::set_brightness(uint8_t value) {
     lcd.setBrightness(brightness_);
 }
 
+void HaDeckDevice::set_refresh_active_period(uint32_t value) {
+    refresh_active_period_ = value;
+}
+
+void HaDeckDevice::set_refresh_idle_period(uint32_t value) {
+    refresh_idle_period_ = value;
+}
+
+void HaDeckDevice::set_refresh_idle_timeout(uint32_t value) {
+    refresh_idle_timeout_ = value;
+}
+
+void HaDeckDevice::set_draw_buffer_lines(uint16_t value) {
+    draw_buffer_lines_ = value;
+}
+
+void HaDeckDevice::set_draw_buffer_count(uint8_t value) {
+    draw_buffer_count_ = value;
+}
+
+void HaDeckDevice::set_draw_buffer_psram(bool value) {
+    draw_buffer_psram_ = value;
+}
+
+void HaDeckDevice::set_full_frame(bool value) {
+    full_frame_ = value;
+}
+
+void HaDeckDevice::set_benchmark(bool value) {
+    benchmark_ = value;
+}
+
+void HaDeckDevice::set_hardware_rotation(bool value) {
+    hardware_rotation_ = value;
+}
+
+void HaDeckDevice::set_bus_frequency(uint32_t value) {
+    bus_frequency_ = value;
+}
+
+void HaDeckDevice::set_splash(bool value) {
+    splash_ = value;
+}
+
+void HaDeckDevice::set_splash_delay(uint32_t value) {
+    splash_delay_ = value;
+}
+
+void HaDeckDevice::set_splash_min_interval(uint32_t value) {
+    splash_min_interval_ = value;
+}
+
+void HaDeckDevice::set_splash_hold_timeout(uint32_t value) {
+    splash_hold_timeout_ = value;
+}
+
+uint32_t HaDeckDevice::get_boot_phase_time(BootPhase phase) const {
+    return boot_phase_time_[phase];
+}
+
+uint32_t HaDeckDevice::get_time_to_first_frame() const {
+    return first_frame_ms;
+}
+
+uint32_t HaDeckDevice::get_bus_frequency() {
+    return lcd.get_write_freq();
+}
+
+const char *HaDeckDevice::get_refresh_mode_name() const {
+    return refresh_mode_ == REFRESH_MODE_ACTIVE ? "active" : "idle";
+}
+
+uint32_t HaDeckDevice::get_refresh_mode_time(RefreshMode mode) const {
+    uint32_t total = refresh_mode_time_[mode];
+    if (mode == refresh_mode_)
+        total += millis() - refresh_mode_since_;
+    return total;
+}
+
+float HaDeckDevice::get_refresh_idle_ratio() const {
+    uint32_t active = get_refresh_mode_time(REFRESH_MODE_ACTIVE);
+    uint32_t idle = get_refresh_mode_time(REFRESH_MODE_IDLE);
+    return active + idle > 0 ? idle * 100.0f / (active + idle) : 0.0f;
+}
+
+void HaDeckDevice::configure_rotation_(lv_disp_drv_t *drv, bool hardware) {
+    if (hardware) {
+        // ST7796 memory access control does the rotation, touch is mapped by LovyanGFX
+        lcd.setRotation(TFT_ROTATION);
+        drv->hor_res = TFT_HEIGHT;
+        drv->ver_res = TFT_WIDTH;
+        drv->rotated = LV_DISP_ROT_NONE;
+        drv->sw_rotate = 0;
+    } else {
+        lcd.setRotation(0);
+        drv->hor_res = TFT_WIDTH;
+        drv->ver_res = TFT_HEIGHT;
+        drv->rotated = LV_DISP_ROT_90;
+        drv->sw_rotate = 1;
+    }
+}
+
+void HaDeckDevice::run_bus_benchmark_() {
+    const uint8_t frames = 5;
+
+    // Plain fills, no LVGL involved, so this is what the bus itself achieves
+    uint32_t start = micros();
+    for (uint8_t i = 0; i < frames; i++)
+        lcd.fillScreen(i % 2 ? TFT_BLACK : TFT_DARKGREY);
+    uint32_t elapsed = micros() - start;
+
+    ESP_LOGI(TAG, "Bus clock %.1f MHz: fill rate %.2f Mpx/s", get_bus_frequency() / 1e6f,
+        elapsed > 0 ? (float) frames * TFT_WIDTH * TFT_HEIGHT / elapsed : 0.0f);
+}
+
+float HaDeckDevice::measure_flush_rate_(lv_disp_t *disp) {
+    const uint8_t frames = 10;
+
+    // Timed around the whole refresh, so rendering and software rotation count too
+    flush_pixel_count = 0;
+    uint32_t start = micros();
+    for (uint8_t i = 0; i < frames; i++) {
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(disp);
+    }
+    lcd.waitDMA();
+    uint32_t elapsed = micros() - start;
+
+    return elapsed > 0 ? (float) flush_pixel_count / elapsed : 0.0f;
+}
+
+void HaDeckDevice::run_rotation_benchmark_(lv_disp_t *disp) {
+    lv_disp_drv_t *drv = disp->driver;
+
+    configure_rotation_(drv, false);
+    lv_disp_drv_update(disp, drv);
+    float software = measure_flush_rate_(disp);
+
+    configure_rotation_(drv, true);
+    lv_disp_drv_update(disp, drv);
+    float hardware = measure_flush_rate_(disp);
+
+    configure_rotation_(drv, hardware_rotation_);
+    lv_disp_drv_update(disp, drv);
+
+    ESP_LOGI(TAG, "Refresh throughput: software rotation %.2f Mpx/s, hardware rotation %.2f Mpx/s",
+        software, hardware);
+}
+
+bool HaDeckDevice::has_activity_() {
+    // FT5x06 keeps INT low while the panel is touched
+    if (gpio_get_level((gpio_num_t) TOUCH_INT) == 0)
+        return true;
+
+    if (lv_anim_count_running() > 0)
+        return true;
+
+    lv_disp_t *disp = lv_disp_get_default();
+    return disp && disp->inv_p > 0;
+}
+
+void HaDeckDevice::set_refresh_mode_(RefreshMode mode, uint32_t now) {
+    if (refresh_mode_ == mode)
+        return;
+
+    refresh_mode_time_[refresh_mode_] += now - refresh_mode_since_;
+    refresh_mode_since_ = now;
+    refresh_mode_ = mode;
+}
+
+bool HaDeckDevice::show_splash_() {
+    static uint16_t chunk[LVGL_LINE_WIDTH];
+
+    if (!splash_store_.init()) {
+        splash_ = false;
+        return false;
+    }
+    if (!splash_store_.has_frame())
+        return false;
+
+    // The frame is always stored landscape, as LVGL renders it
+    if (splash_store_.get_width() != TFT_HEIGHT || splash_store_.get_height() != TFT_WIDTH) {
+        ESP_LOGW(TAG, "Stored splash is %ux%u, ignoring", splash_store_.get_width(), splash_store_.get_height());
+        return false;
+    }
+
+    lcd.setRotation(TFT_ROTATION);
+    lcd.startWrite();
+    lcd.setAddrWindow(0, 0, TFT_HEIGHT, TFT_WIDTH);
+    bool ok = splash_store_.decode(chunk, LVGL_LINE_WIDTH, [](const uint16_t *pixels, size_t len) {
+        lcd.writePixels((const panel_pixel_t *)pixels, len);
+    });
+    lcd.endWrite();
+
+    if (!ok) {
+        ESP_LOGW(TAG, "Stored splash is corrupted");
+        return false;
+    }
+
+    first_frame_ms = millis();
+    ESP_LOGD(TAG, "Splash shown %u ms after power-on", first_frame_ms);
+    return true;
+}
+
+void HaDeckDevice::release_splash_() {
+    if (!splash_hold)
+        return;
+
+    splash_hold = false;
+    lv_obj_invalidate(lv_scr_act());
+}
+
+void HaDeckDevice::splash_ready_cb(lv_event_t *e) {
+    auto device = (HaDeckDevice *) lv_event_get_user_data(e);
+    device->release_splash_();
+}
+
+void HaDeckDevice::capture_splash_(uint32_t now) {
+    // Only a settled main screen is worth keeping, not a pushed page, a screen
+    // still being built or a running animation. Flash is written at most once
+    // per min_interval.
+    if (splash_storing_ || !frame_changed || lv_scr_act() != splash_screen_
+            || !lv_obj_has_flag(splash_screen_, DECK_SETTLED_FLAG))
+        return;
+    if (now - last_activity_ < splash_delay_)
+        return;
+    if (splash_saved_at_ > 0 && now - splash_saved_at_ < splash_min_interval_)
+        return;
+
+    uint32_t size = lv_snapshot_buf_size_needed(splash_screen_, LV_IMG_CF_TRUE_COLOR);
+    auto buffer = (uint16_t *) heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!buffer)
+        return;
+
+    lv_img_dsc_t dsc;
+    if (lv_snapshot_take_to_buf(splash_screen_, LV_IMG_CF_TRUE_COLOR, &dsc, buffer, size) != LV_RES_OK) {
+        heap_caps_free(buffer);
+        return;
+    }
+
+    frame_changed = false;
+    splash_saved_at_ = now;
+    splash_pixels_ = buffer;
+    splash_width_ = dsc.header.w;
+    splash_height_ = dsc.header.h;
+    splash_storing_ = true;
+
+    // Compression and flash writes take a while, keep them off the UI core
+    if (xTaskCreatePinnedToCore(splash_store_task, "splash_store", 4096, this, 1, nullptr, 0) != pdPASS) {
+        heap_caps_free(splash_pixels_);
+        splash_pixels_ = nullptr;
+        splash_storing_ = false;
+    }
+}
+
+void HaDeckDevice::splash_store_task(void *param) {
+    auto device = (HaDeckDevice *) param;
+
+    if (!device->splash_store_.store(device->splash_pixels_, device->splash_width_, device->splash_height_))
+        ESP_LOGW(TAG, "Unable to store the splash");
+
+    heap_caps_free(device->splash_pixels_);
+    device->splash_pixels_ = nullptr;
+    device->splash_storing_ = false;
+    vTaskDelete(nullptr);
+}
+
+uint32_t HaDeckDevice::draw_buffer_caps_() const {
+    return draw_buffer_psram_
+        ? MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT
+        : MALLOC_CAP_DMA | MALLOC_CAP_32BIT;
+}
+
+bool HaDeckDevice::allocate_draw_buffers_(uint16_t lines, uint8_t count) {
+    size_t size = LVGL_LINE_WIDTH * lines * sizeof(lv_color_t);
+
+    for (uint8_t i = 0; i < count; i++) {
+        draw_buffer_[i] = (lv_color_t *)heap_caps_malloc(size, draw_buffer_caps_());
+        if (!draw_buffer_[i]) {
+            free_draw_buffers_();
+            return false;
+        }
+    }
+
+    lv_disp_draw_buf_init(&draw_buf, draw_buffer_[0], draw_buffer_[1], LVGL_LINE_WIDTH * lines);
+    return true;
+}
+
+void HaDeckDevice::free_draw_buffers_() {
+    for (auto &buffer : draw_buffer_) {
+        heap_caps_free(buffer);
+        buffer = nullptr;
+    }
+}
+
+bool HaDeckDevice::setup_draw_buffers_() {
+    uint16_t lines = full_frame_ ? LVGL_LINES_MAX : draw_buffer_lines_;
+
+    // Fall back to fewer lines first, then to a single buffer
+    for (uint8_t count = draw_buffer_count_; count > 0; count--) {
+        for (uint16_t l = lines; l >= LVGL_LINES_MIN; l /= 2) {
+            if (!allocate_draw_buffers_(l, count))
+                continue;
+
+            if (l != lines || count != draw_buffer_count_) {
+                ESP_LOGW(TAG, "Draw buffer reduced to %u x %u lines (requested %u x %u)",
+                    count, l, draw_buffer_count_, lines);
+            }
+            draw_buffer_lines_ = l;
+            draw_buffer_count_ = count;
+            ESP_LOGD(TAG, "Draw buffer: %u x %u lines in %s", count, l,
+                draw_buffer_psram_ ? "PSRAM" : "internal RAM");
+            return true;
+        }
+    }
+
+    ESP_LOGE(TAG, "Unable to allocate draw buffer");
+    return false;
+}
+
+void HaDeckDevice::run_benchmark_(lv_disp_t *disp) {
+    static const uint16_t sizes[] = {10, 20, 40, 80, 160, LVGL_LINES_MAX};
+    const uint8_t frames = 10;
+
+    ESP_LOGI(TAG, "Draw buffer benchmark (%u buffer(s) in %s, %u frames):", draw_buffer_count_,
+        draw_buffer_psram_ ? "PSRAM" : "internal RAM", frames);
+
+    free_draw_buffers_();
+    for (auto lines : sizes) {
+        size_t heap_before = heap_caps_get_free_size(draw_buffer_caps_());
+        if (!allocate_draw_buffers_(lines, draw_buffer_count_)) {
+            ESP_LOGI(TAG, "  %3u lines: allocation failed", lines);
+            continue;
+        }
+        size_t heap_used = heap_before - heap_caps_get_free_size(draw_buffer_caps_());
+
+        uint32_t start = micros();
+        for (uint8_t i = 0; i < frames; i++) {
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(disp);
+        }
+        uint32_t elapsed = micros() - start;
+
+        ESP_LOGI(TAG, "  %3u lines: %.1f FPS, %u bytes of heap", lines,
+            frames * 1000000.0f / elapsed, heap_used);
+        free_draw_buffers_();
+    }
+
+    if (!setup_draw_buffers_())
+        mark_failed();
+}
+
 }  // namespace hd_device
 }  // namespace esphome
\ No newline at end of file
@@ -5,13 +5,31 @@
 #include "esphome/core/log.h"
 #include <algorithm>  // Add this for std::max
 #include "LGFX.h"
+#include "splash.h"
 #include "lvgl.h"
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
 
 LV_IMG_DECLARE(bg_480x320);
 
 namespace esphome {
 namespace hd_device {
 
+enum RefreshMode : uint8_t {
+    REFRESH_MODE_ACTIVE = 0,
+    REFRESH_MODE_IDLE = 1,
+};
+
+enum BootPhase : uint8_t {
+    BOOT_PHASE_PANEL = 0,
+    BOOT_PHASE_LVGL,
+    BOOT_PHASE_FONTS,
+    BOOT_PHASE_DISPLAY,
+    BOOT_PHASE_FIRST_FRAME,
+    BOOT_PHASE_COUNT,
+};
+
 class HaDeckDevice : public Component
 {
 public:
@@ -21,12 +39,98 @@ public:
     uint8_t get_brightness();
     void set_brightness(uint8_t value);
     uint32_t get_boot_time() const { return boot_start_time_; }
+    // Time (ms) from the start of setup() until the phase completed
+    uint32_t get_boot_phase_time(BootPhase phase) const;
+    // Time (ms) from power-on until the first frame was flushed
+    uint32_t get_time_to_first_frame() const;
+#ifdef USE_SENSOR
+    void set_time_to_first_frame_sensor(sensor::Sensor *sensor) { time_to_first_frame_sensor_ = sensor; }
+#endif
+
+    void set_draw_buffer_lines(uint16_t value);
+    void set_draw_buffer_count(uint8_t value);
+    void set_draw_buffer_psram(bool value);
+    void set_full_frame(bool value);
+    void set_benchmark(bool value);
+    void set_hardware_rotation(bool value);
+    void set_bus_frequency(uint32_t value);
+    uint32_t get_bus_frequency();
+
+    void set_refresh_active_period(uint32_t value);
+    void set_refresh_idle_period(uint32_t value);
+    void set_refresh_idle_timeout(uint32_t value);
+    RefreshMode get_refresh_mode() const { return refresh_mode_; }
+    const char *get_refresh_mode_name() const;
+    // Total time (ms) spent in the given refresh mode since boot
+    uint32_t get_refresh_mode_time(RefreshMode mode) const;
+    // Share (%) of the time since boot spent in the idle refresh mode
+    float get_refresh_idle_ratio() const;
+#ifdef USE_SENSOR
+    void set_refresh_idle_ratio_sensor(sensor::Sensor *sensor) { refresh_idle_ratio_sensor_ = sensor; }
+#endif
+
+    void set_splash(bool value);
+    void set_splash_delay(uint32_t value);
+    void set_splash_min_interval(uint32_t value);
+    void set_splash_hold_timeout(uint32_t value);
 private:
+    uint32_t draw_buffer_caps_() const;
+    bool allocate_draw_buffers_(uint16_t lines, uint8_t count);
+    void free_draw_buffers_();
+    bool setup_draw_buffers_();
+    void run_benchmark_(lv_disp_t *disp);
+    void configure_rotation_(lv_disp_drv_t *drv, bool hardware);
+    void run_bus_benchmark_();
+    float measure_flush_rate_(lv_disp_t *disp);
+    void run_rotation_benchmark_(lv_disp_t *disp);
+    bool has_activity_();
+    void set_refresh_mode_(RefreshMode mode, uint32_t now);
+    bool show_splash_();
+    void release_splash_();
+    void capture_splash_(uint32_t now);
+    static void splash_store_task(void *param);
+    static void splash_ready_cb(lv_event_t *e);
+
     unsigned long time_ = 0;
     uint8_t brightness_ = 100;  // Initialize brightness_ with a default value
     uint8_t current_brightness = 0;
     unsigned long boot_start_time_ = 0;
+    uint32_t boot_phase_time_[BOOT_PHASE_COUNT] = {};
     static void lvgl_init_task(void *param);
+#ifdef USE_SENSOR
+    sensor::Sensor *time_to_first_frame_sensor_ = nullptr;
+    sensor::Sensor *refresh_idle_ratio_sensor_ = nullptr;
+#endif
+
+    uint16_t draw_buffer_lines_ = 20;
+    uint8_t draw_buffer_count_ = 1;
+    bool draw_buffer_psram_ = false;
+    bool full_frame_ = false;
+    bool benchmark_ = false;
+    bool hardware_rotation_ = true;
+    uint32_t bus_frequency_ = 20000000;
+    lv_color_t *draw_buffer_[2] = {nullptr, nullptr};
+
+    RefreshMode refresh_mode_ = REFRESH_MODE_ACTIVE;
+    uint32_t refresh_active_period_ = 10;
+    uint32_t refresh_idle_period_ = 100;
+    uint32_t refresh_idle_timeout_ = 500;
+    uint32_t refresh_mode_since_ = 0;
+    uint32_t refresh_mode_time_[2] = {0, 0};
+    uint32_t last_tick_ = 0;
+    uint32_t last_activity_ = 0;
+
+    bool splash_ = false;
+    uint32_t splash_delay_ = 10000;
+    uint32_t splash_min_interval_ = 600000;
+    uint32_t splash_hold_timeout_ = 15000;
+    SplashStore splash_store_;
+    lv_obj_t *splash_screen_ = nullptr;
+    uint32_t splash_saved_at_ = 0;
+    uint16_t *splash_pixels_ = nullptr;
+    uint16_t splash_width_ = 0;
+    uint16_t splash_height_ = 0;
+    volatile bool splash_storing_ = false;
 };
 
 }  // namespace hd_device   
@@ -0,0 +1,142 @@
+#include "splash.h"
+#include "esphome/core/log.h"
+#include <esp_heap_caps.h>
+#include <esp_rom_crc.h>
+#include <algorithm>
+
+namespace esphome {
+namespace hd_device {
+
+static const uint32_t SPLASH_MAGIC = 0x48445350;  // "HDSP"
+static const size_t SPLASH_READ_CHUNK = 1024;
+
+bool SplashStore::init() {
+    partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "splash");
+    if (!partition_) {
+        ESP_LOGW(this->TAG, "No 'splash' partition, the last frame won't be kept");
+        return false;
+    }
+
+    if (esp_partition_read(partition_, 0, &header_, sizeof(header_)) != ESP_OK)
+        return false;
+
+    valid_ = header_.magic == SPLASH_MAGIC
+        && header_.size > 0
+        && header_.size + sizeof(header_) <= partition_->size
+        && check_crc_();
+    return true;
+}
+
+bool SplashStore::check_crc_() {
+    // A frame cut short by a power loss must not reach the panel
+    uint8_t buf[SPLASH_READ_CHUNK];
+    uint32_t crc = 0;
+    for (uint32_t offset = 0; offset < header_.size; offset += sizeof(buf)) {
+        size_t len = std::min<size_t>(sizeof(buf), header_.size - offset);
+        if (esp_partition_read(partition_, sizeof(header_) + offset, buf, len) != ESP_OK)
+            return false;
+        crc = esp_rom_crc32_le(crc, buf, len);
+    }
+
+    if (crc != header_.crc) {
+        ESP_LOGW(this->TAG, "Stored frame is corrupt, not showing it");
+        return false;
+    }
+    return true;
+}
+
+bool SplashStore::decode(uint16_t *chunk, size_t chunk_len, std::function<void(const uint16_t *, size_t)> &&sink) {
+    if (!valid_)
+        return false;
+
+    // Each run is [count][color], both 16 bit
+    uint16_t runs[SPLASH_READ_CHUNK / sizeof(uint16_t)];
+    size_t filled = 0;
+    uint32_t pixels = 0;
+    const uint32_t total = (uint32_t) header_.width * header_.height;
+
+    for (uint32_t offset = 0; offset < header_.size; offset += sizeof(runs)) {
+        size_t len = std::min<size_t>(sizeof(runs), header_.size - offset);
+        if (esp_partition_read(partition_, sizeof(header_) + offset, runs, len) != ESP_OK)
+            return false;
+
+        for (size_t i = 0; i + 1 < len / sizeof(uint16_t); i += 2) {
+            for (uint16_t n = runs[i]; n > 0; n--) {
+                chunk[filled++] = runs[i + 1];
+                if (filled == chunk_len) {
+                    sink(chunk, filled);
+                    pixels += filled;
+                    filled = 0;
+                }
+            }
+        }
+    }
+
+    if (filled > 0) {
+        sink(chunk, filled);
+        pixels += filled;
+    }
+    return pixels == total;
+}
+
+bool SplashStore::store(const uint16_t *pixels, uint16_t width, uint16_t height) {
+    if (!partition_)
+        return false;
+
+    const size_t total = (size_t) width * height;
+    const size_t capacity = (partition_->size - sizeof(Header)) / sizeof(uint16_t);
+    auto rle = (uint16_t *) heap_caps_malloc(capacity * sizeof(uint16_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!rle) {
+        ESP_LOGW(this->TAG, "Not enough memory to compress the frame");
+        return false;
+    }
+
+    size_t len = 0;
+    for (size_t i = 0; i < total;) {
+        uint16_t color = pixels[i];
+        uint16_t count = 1;
+        while (i + count < total && count < UINT16_MAX && pixels[i + count] == color)
+            count++;
+        i += count;
+
+        if (len + 2 > capacity) {
+            ESP_LOGW(this->TAG, "Frame doesn't compress into the partition, skipping");
+            heap_caps_free(rle);
+            return false;
+        }
+        rle[len++] = count;
+        rle[len++] = color;
+    }
+
+    Header header{};
+    header.magic = SPLASH_MAGIC;
+    header.width = width;
+    header.height = height;
+    header.size = len * sizeof(uint16_t);
+    header.crc = esp_rom_crc32_le(0, (const uint8_t *) rle, header.size);
+
+    // Identical frames don't cost an erase cycle
+    if (valid_ && header.crc == header_.crc && header.size == header_.size
+            && header.width == header_.width && header.height == header_.height) {
+        heap_caps_free(rle);
+        return true;
+    }
+
+    // Invalidate first so a power loss mid-write doesn't leave a broken frame behind
+    const size_t sector = 4096;
+    size_t erase = (sizeof(Header) + header.size + sector - 1) / sector * sector;
+    bool ok = esp_partition_erase_range(partition_, 0, erase) == ESP_OK
+        && esp_partition_write(partition_, sizeof(Header), rle, header.size) == ESP_OK
+        && esp_partition_write(partition_, 0, &header, sizeof(Header)) == ESP_OK;
+    heap_caps_free(rle);
+
+    valid_ = ok;
+    if (ok) {
+        header_ = header;
+        ESP_LOGD(this->TAG, "Stored %ux%u frame in %u bytes", width, height, header.size);
+    }
+    return ok;
+}
+
+}  // namespace hd_device
+}  // namespace esphome
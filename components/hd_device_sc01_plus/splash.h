@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <esp_partition.h>
+
+namespace esphome {
+namespace hd_device {
+
+// Keeps a run-length encoded RGB565 frame in the "splash" data partition.
+// Pixels are stored in the byte order LVGL renders in, so they can be pushed
+// to the panel without conversion.
+class SplashStore
+{
+public:
+    bool init();
+    bool has_frame() const { return valid_; }
+    uint16_t get_width() const { return header_.width; }
+    uint16_t get_height() const { return header_.height; }
+
+    // Decodes the stored frame, calling sink with consecutive runs of up to
+    // `chunk` pixels in row-major order
+    bool decode(uint16_t *chunk, size_t chunk_len, std::function<void(const uint16_t *, size_t)> &&sink);
+    // Compresses and writes the frame unless it matches the stored one.
+    // Blocks on flash erase/write, call it from a background task.
+    bool store(const uint16_t *pixels, uint16_t width, uint16_t height);
+private:
+    struct Header {
+        uint32_t magic;
+        uint16_t width;
+        uint16_t height;
+        uint32_t size;   // bytes of RLE data following the header
+        uint32_t crc;    // CRC32 of the RLE data
+    };
+
+    bool check_crc_();
+
+    const char *TAG = "HD_SPLASH";
+    const esp_partition_t *partition_ = nullptr;
+    Header header_{};
+    bool valid_ = false;
+};
+
+}  // namespace hd_device
+}  // namespace esphome
@@ -10,15 +10,38 @@ from esphome.const import (
     CONF_BRIGHTNESS
 )
 
+CONF_DRAW_BUFFER = "draw_buffer"
+CONF_LINES = "lines"
+CONF_COUNT = "count"
+CONF_MEMORY = "memory"
+CONF_FULL_FRAME = "full_frame"
+CONF_BENCHMARK = "benchmark"
+
+DRAW_BUFFER_MEMORY = {
+    "internal": False,
+    "psram": True,
+}
+
 CODEOWNERS = ["@strange-v"]
 
 hd_device_ns = cg.esphome_ns.namespace("hd_device")
 HaDeckDevice = hd_device_ns.class_("HaDeckDevice", cg.Component)
 
+DRAW_BUFFER_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_LINES, default=20): cv.int_range(min=4, max=480),
+        cv.Optional(CONF_COUNT, default=1): cv.int_range(min=1, max=2),
+        cv.Optional(CONF_MEMORY, default="internal"): cv.one_of(*DRAW_BUFFER_MEMORY, lower=True),
+        cv.Optional(CONF_FULL_FRAME, default=False): cv.boolean,
+    }
+)
+
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(HaDeckDevice),
         cv.Required(CONF_BRIGHTNESS): cv.int_range(min=0, max=100),
+        cv.Optional(CONF_DRAW_BUFFER, default={}): DRAW_BUFFER_SCHEMA,
+        cv.Optional(CONF_BENCHMARK, default=False): cv.boolean,
     }
 )
 
@@ -45,3 +68,10 @@ async def to_code(config):
 
     brightness = config.get(CONF_BRIGHTNESS)
     cg.add(var.set_brightness(brightness))
+
+    draw_buffer = config[CONF_DRAW_BUFFER]
+    cg.add(var.set_draw_buffer_lines(draw_buffer[CONF_LINES]))
+    cg.add(var.set_draw_buffer_count(draw_buffer[CONF_COUNT]))
+    cg.add(var.set_draw_buffer_psram(DRAW_BUFFER_MEMORY[draw_buffer[CONF_MEMORY]]))
+    cg.add(var.set_full_frame(draw_buffer[CONF_FULL_FRAME]))
+    cg.add(var.set_benchmark(config[CONF_BENCHMARK]))
@@ -1,12 +1,23 @@
 #include "hd_device_wt32s3_86s.h"
 #include <vector>
 
+#define LVGL_LINE_WIDTH TFT_WIDTH
+#define LVGL_LINES_MAX TFT_HEIGHT
+#define LVGL_LINES_MIN 4
+
 namespace esphome {
 namespace hd_device {
 
+// Pixel type matching the byte order LVGL renders in (LV_COLOR_16_SWAP in lv_conf.h).
+// With the swapped order the panel takes LVGL's buffer as is.
+#if LV_COLOR_16_SWAP
+typedef lgfx::swap565_t panel_pixel_t;
+#else
+typedef lgfx::rgb565_t panel_pixel_t;
+#endif
+
 static const char *const TAG = "HD_DEVICE";
 static lv_disp_draw_buf_t draw_buf;
-static lv_color_t *buf = (lv_color_t *)heap_caps_malloc(TFT_HEIGHT * 20 * sizeof(lv_color_t), MALLOC_CAP_DMA);
 
 LGFX lcd;
 
@@ -15,7 +26,9 @@ lv_group_t *group;
 
 void IRAM_ATTR flush_pixels(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
 {
-    lcd.pushImageDMA(area->x1, area->y1, area->x2 - area->x1 + 1, area->y2 - area->y1 + 1, (lgfx::swap565_t*)&color_p->full);
+    lcd.pushImageDMA(area->x1, area->y1, area->x2 - area->x1 + 1, area->y2 - area->y1 + 1, (const panel_pixel_t *)color_p);
+    // The buffer must not be handed back to LVGL while DMA still reads it
+    lcd.waitDMA();
     lv_disp_flush_ready(disp);
 }
 
@@ -39,7 +52,10 @@ void HaDeckDevice::setup() {
 
     lcd.init();
 
-    lv_disp_draw_buf_init(&draw_buf, buf, NULL, TFT_HEIGHT * 20);
+    if (!setup_draw_buffers_()) {
+        mark_failed();
+        return;
+    }
 
     static lv_disp_drv_t disp_drv;
     lv_disp_drv_init(&disp_drv);
@@ -67,6 +83,9 @@ void HaDeckDevice::setup() {
     auto bg_image = lv_img_create(lv_scr_act());
     lv_img_set_src(bg_image, &bg_default);
     lv_obj_set_parent(bg_image, lv_scr_act());
+
+    if (benchmark_)
+        run_benchmark_(disp);
 }
 
 void HaDeckDevice::loop() {
@@ -79,7 +98,7 @@ void HaDeckDevice::loop() {
     }
 }
 
-float HaDeckDevice::get_setup_priority() const { return setup_priority::DATA; }
+float HaDeckDevice::get_setup_priority() const { return setup_priority::HARDWARE; }
 
 uint8_t HaDeckDevice::get_brightness() {
     return brightness_;
@@ -90,5 +109,110 @@ void HaDeckDevice::set_brightness(uint8_t value) {
     lcd.setBrightness(brightness_);
 }
 
+void HaDeckDevice::set_draw_buffer_lines(uint16_t value) {
+    draw_buffer_lines_ = value;
+}
+
+void HaDeckDevice::set_draw_buffer_count(uint8_t value) {
+    draw_buffer_count_ = value;
+}
+
+void HaDeckDevice::set_draw_buffer_psram(bool value) {
+    draw_buffer_psram_ = value;
+}
+
+void HaDeckDevice::set_full_frame(bool value) {
+    full_frame_ = value;
+}
+
+void HaDeckDevice::set_benchmark(bool value) {
+    benchmark_ = value;
+}
+
+uint32_t HaDeckDevice::draw_buffer_caps_() const {
+    return draw_buffer_psram_
+        ? MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT
+        : MALLOC_CAP_DMA | MALLOC_CAP_32BIT;
+}
+
+bool HaDeckDevice::allocate_draw_buffers_(uint16_t lines, uint8_t count) {
+    size_t size = LVGL_LINE_WIDTH * lines * sizeof(lv_color_t);
+
+    for (uint8_t i = 0; i < count; i++) {
+        draw_buffer_[i] = (lv_color_t *)heap_caps_malloc(size, draw_buffer_caps_());
+        if (!draw_buffer_[i]) {
+            free_draw_buffers_();
+            return false;
+        }
+    }
+
+    lv_disp_draw_buf_init(&draw_buf, draw_buffer_[0], draw_buffer_[1], LVGL_LINE_WIDTH * lines);
+    return true;
+}
+
+void HaDeckDevice::free_draw_buffers_() {
+    for (auto &buffer : draw_buffer_) {
+        heap_caps_free(buffer);
+        buffer = nullptr;
+    }
+}
+
+bool HaDeckDevice::setup_draw_buffers_() {
+    uint16_t lines = full_frame_ ? LVGL_LINES_MAX : draw_buffer_lines_;
+
+    // Fall back to fewer lines first, then to a single buffer
+    for (uint8_t count = draw_buffer_count_; count > 0; count--) {
+        for (uint16_t l = lines; l >= LVGL_LINES_MIN; l /= 2) {
+            if (!allocate_draw_buffers_(l, count))
+                continue;
+
+            if (l != lines || count != draw_buffer_count_) {
+                ESP_LOGW(TAG, "Draw buffer reduced to %u x %u lines (requested %u x %u)",
+                    count, l, draw_buffer_count_, lines);
+            }
+            draw_buffer_lines_ = l;
+            draw_buffer_count_ = count;
+            ESP_LOGD(TAG, "Draw buffer: %u x %u lines in %s", count, l,
+                draw_buffer_psram_ ? "PSRAM" : "internal RAM");
+            return true;
+        }
+    }
+
+    ESP_LOGE(TAG, "Unable to allocate draw buffer");
+    return false;
+}
+
+void HaDeckDevice::run_benchmark_(lv_disp_t *disp) {
+    static const uint16_t sizes[] = {10, 20, 40, 80, 160, LVGL_LINES_MAX};
+    const uint8_t frames = 10;
+
+    ESP_LOGI(TAG, "Draw buffer benchmark (%u buffer(s) in %s, %u frames):", draw_buffer_count_,
+        draw_buffer_psram_ ? "PSRAM" : "internal RAM", frames);
+
+    free_draw_buffers_();
+    for (auto lines : sizes) {
+        size_t heap_before = heap_caps_get_free_size(draw_buffer_caps_());
+        if (!allocate_draw_buffers_(lines, draw_buffer_count_)) {
+            ESP_LOGI(TAG, "  %3u lines: allocation failed", lines);
+            continue;
+        }
+        size_t heap_used = heap_before - heap_caps_get_free_size(draw_buffer_caps_());
+
+        uint32_t start = micros();
+        for (uint8_t i = 0; i < frames; i++) {
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(disp);
+        }
+        uint32_t elapsed = micros() - start;
+
+        ESP_LOGI(TAG, "  %3u lines: %.1f FPS, %u bytes of heap", lines,
+            frames * 1000000.0f / elapsed, heap_used);
+        free_draw_buffers_();
+    }
+
+    if (!setup_draw_buffers_())
+        mark_failed();
+}
+
 }  // namespace hd_device
 }  // namespace esphome
\ No newline at end of file
@@ -19,9 +19,28 @@ public:
     float get_setup_priority() const override;
     uint8_t get_brightness();
     void set_brightness(uint8_t value);
+
+    void set_draw_buffer_lines(uint16_t value);
+    void set_draw_buffer_count(uint8_t value);
+    void set_draw_buffer_psram(bool value);
+    void set_full_frame(bool value);
+    void set_benchmark(bool value);
 private:
+    uint32_t draw_buffer_caps_() const;
+    bool allocate_draw_buffers_(uint16_t lines, uint8_t count);
+    void free_draw_buffers_();
+    bool setup_draw_buffers_();
+    void run_benchmark_(lv_disp_t *disp);
+
     unsigned long time_ = 0;
     uint8_t brightness_ = 0;
+
+    uint16_t draw_buffer_lines_ = 20;
+    uint8_t draw_buffer_count_ = 1;
+    bool draw_buffer_psram_ = false;
+    bool full_frame_ = false;
+    bool benchmark_ = false;
+    lv_color_t *draw_buffer_[2] = {nullptr, nullptr};
 };
 
 }  // namespace hd_device